@@ -0,0 +1,121 @@
+#include "BenchmarkSuite.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+namespace {
+
+const int JSON_VERSION = 1;
+
+// Pull "name" and "items_per_second" out of every result of a file written
+// by writeJson. Not a general JSON reader: it relies on the writer putting
+// the name before the numbers of each result.
+bool readBaseline(const std::string& path, std::map<std::string, double>& rates) {
+    std::ifstream file(path);
+    if (!file)
+        return false;
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string text = buffer.str();
+
+    const std::string nameKey = "\"name\": \"";
+    const std::string rateKey = "\"items_per_second\": ";
+    size_t position = 0;
+    while ((position = text.find(nameKey, position)) != std::string::npos) {
+        size_t begin = position + nameKey.size();
+        size_t end = text.find('"', begin);
+        size_t rate = text.find(rateKey, end);
+        if (end == std::string::npos || rate == std::string::npos)
+            return false;
+        rates[text.substr(begin, end - begin)] = std::strtod(text.c_str() + rate + rateKey.size(), nullptr);
+        position = rate;
+    }
+    return true;
+}
+
+} // namespace
+
+void BenchmarkSuite::add(const std::string& name, const std::string& unit, double itemsPerStep, int steps, BenchmarkSetup setup) {
+    cases.push_back({name, unit, itemsPerStep, steps, setup});
+}
+
+void BenchmarkSuite::run() {
+    results.clear();
+    for (const Case& benchmark : cases) {
+        if (!filter.empty() && benchmark.name.find(filter) == std::string::npos)
+            continue;
+
+        std::vector<double> stepMs;
+        for (int sample = 0; sample < samples; sample++) {
+            BenchmarkStep step = benchmark.setup();
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < benchmark.steps; i++) {
+                step();
+            }
+            stepMs.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() /
+                             benchmark.steps);
+        }
+        std::sort(stepMs.begin(), stepMs.end());
+
+        BenchmarkResult result;
+        result.name = benchmark.name;
+        result.unit = benchmark.unit;
+        result.itemsPerStep = benchmark.itemsPerStep;
+        result.steps = benchmark.steps;
+        result.samples = samples;
+        result.medianMs = stepMs[stepMs.size() / 2];
+        result.minMs = stepMs.front();
+        result.itemsPerSecond = result.medianMs > 0.0 ? benchmark.itemsPerStep * 1000.0 / result.medianMs : 0.0;
+        results.push_back(result);
+
+        std::cout << result.name << " median=" << result.medianMs << "ms min=" << result.minMs << "ms " << result.unit
+                  << "/s=" << result.itemsPerSecond << "\n";
+    }
+}
+
+bool BenchmarkSuite::writeJson(const std::string& path) const {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+        std::cerr << "Failed to open benchmark file " << path << "\n";
+        return false;
+    }
+
+    file << "{\n  \"version\": " << JSON_VERSION << ",\n  \"results\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& result = results[i];
+        file << (i ? ",\n" : "\n") << "    {\"name\": \"" << result.name << "\", \"unit\": \"" << result.unit
+             << "\", \"items_per_step\": " << result.itemsPerStep << ", \"steps\": " << result.steps
+             << ", \"samples\": " << result.samples << ", \"median_ms\": " << result.medianMs << ", \"min_ms\": " << result.minMs
+             << ", \"items_per_second\": " << result.itemsPerSecond << "}";
+    }
+    file << "\n  ]\n}\n";
+    return (bool)file;
+}
+
+int BenchmarkSuite::compare(const std::string& path, double tolerance) const {
+    std::map<std::string, double> baseline;
+    if (!readBaseline(path, baseline)) {
+        std::cerr << "Failed to read benchmark baseline " << path << "\n";
+        return -1;
+    }
+
+    int regressions = 0;
+    for (const BenchmarkResult& result : results) {
+        auto found = baseline.find(result.name);
+        if (found == baseline.end() || found->second <= 0.0) {
+            std::cout << result.name << " new\n";
+            continue;
+        }
+        double ratio = result.itemsPerSecond / found->second;
+        bool regressed = ratio < 1.0 - tolerance;
+        regressions += regressed;
+        std::cout << result.name << " baseline=" << found->second << " now=" << result.itemsPerSecond << " ("
+                  << (ratio - 1.0) * 100.0 << "%)" << (regressed ? " REGRESSION" : "") << "\n";
+    }
+    return regressions;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+// One timed call of a benchmark's hot loop
+typedef std::function<void()> BenchmarkStep;
+
+// Build a fresh, seeded scene and return the step to time. Called before
+// every sample, so each sample runs the same work from the same state.
+typedef std::function<BenchmarkStep()> BenchmarkSetup;
+
+struct BenchmarkResult {
+    std::string name;
+    std::string unit;          // What the items are: cells, agents, bodies...
+    double itemsPerStep = 0.0;
+    int steps = 0;             // Per sample
+    int samples = 0;
+    double medianMs = 0.0;     // Per step, over the samples
+    double minMs = 0.0;
+    double itemsPerSecond = 0.0; // From the median
+};
+
+// Named, seeded benchmarks run a fixed number of steps per sample; the
+// median sample is the result. Results go to a JSON file, and a file from an
+// earlier run can serve as the baseline: any case whose throughput fell by
+// more than the tolerance is reported as a regression.
+class BenchmarkSuite {
+public:
+    void add(const std::string& name, const std::string& unit, double itemsPerStep, int steps, BenchmarkSetup setup);
+
+    // Only run cases whose name contains `value` (empty runs everything)
+    void setFilter(const std::string& value) { filter = value; }
+    void setSamples(int value) { samples = value; }
+
+    // Run the selected cases in the order they were added, a line each
+    void run();
+
+    bool writeJson(const std::string& path) const;
+
+    // Compare this run with a writeJson file. Prints every case next to its
+    // baseline and returns how many are more than `tolerance` (a fraction)
+    // slower, or -1 if the file can't be read.
+    int compare(const std::string& path, double tolerance) const;
+
+    const std::vector<BenchmarkResult>& getResults() const { return results; }
+
+private:
+    struct Case {
+        std::string name;
+        std::string unit;
+        double itemsPerStep;
+        int steps;
+        BenchmarkSetup setup;
+    };
+
+    std::vector<Case> cases;
+    std::vector<BenchmarkResult> results;
+    std::string filter;
+    int samples = 5;
+};
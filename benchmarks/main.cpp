@@ -0,0 +1,193 @@
+#include <box2d/box2d.h>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include "BenchmarkSuite.hpp"
+#include "../box2d-click-boxes/BoxScene.hpp"
+#include "../circle-constraint/ChainSolver.hpp"
+#include "../common/ThreadPool.hpp"
+#include "../common/TransformSync.hpp"
+#include "../flow-field/AgentSystem.hpp"
+#include "../flow-field/FlowField.hpp"
+
+// Every scene below is built from a fixed seed, so a sample does the same
+// work on every run and results can be compared with an earlier file
+
+const int CELL_SIZE = 20; // Flow-field cell, as in the demo
+
+// A gridSize x gridSize field with a sixteenth of the cells blocked
+std::shared_ptr<FlowField> makeField(int gridSize) {
+    auto field = std::make_shared<FlowField>(gridSize * CELL_SIZE, gridSize * CELL_SIZE, CELL_SIZE);
+    std::mt19937 random(1);
+    for (int i = 0; i < gridSize * gridSize / 16; i++) {
+        field->setObstacle(random() % gridSize, random() % gridSize);
+    }
+    return field;
+}
+
+void addFlowFieldCases(BenchmarkSuite& suite) {
+    const int gridSizes[] = {64, 256, 1024};
+    for (int gridSize : gridSizes) {
+        int steps = gridSize >= 1024 ? 2 : gridSize >= 256 ? 10 : 200;
+        for (int weighted = 0; weighted < 2; weighted++) {
+            std::string name = std::string("flowfield/generate/") + (weighted ? "weighted/" : "bfs/") + std::to_string(gridSize);
+            suite.add(name, "cells", (double)gridSize * gridSize, steps, [gridSize, weighted]() -> BenchmarkStep {
+                std::shared_ptr<FlowField> field = makeField(gridSize);
+                field->setMode(weighted ? FlowFieldMode::Weighted : FlowFieldMode::Bfs);
+                sf::Vector2f goal(gridSize * CELL_SIZE / 2, gridSize * CELL_SIZE / 2);
+                return [field, goal]() { field->generateFlowField(goal); };
+            });
+        }
+    }
+}
+
+// The flow-field demo's crowd on a 200x200 field, flow only and with
+// separation
+void addAgentCases(BenchmarkSuite& suite, ThreadPool& pool) {
+    const size_t agentCount = 100000;
+    const int gridSize = 200;
+    for (int separation = 0; separation < 2; separation++) {
+        std::string name = std::string("agents/") + (separation ? "crowd/" : "update/") + std::to_string(agentCount);
+        suite.add(name, "agents", (double)agentCount, 20, [&pool, agentCount, separation]() -> BenchmarkStep {
+            std::shared_ptr<FlowField> field = makeField(gridSize);
+            sf::Vector2f goal(gridSize * CELL_SIZE / 2, gridSize * CELL_SIZE / 2);
+            field->generateFlowField(goal);
+
+            float worldSize = gridSize * CELL_SIZE;
+            auto agents = std::make_shared<AgentSystem>(agentCount, worldSize, worldSize, 10.0f, 1);
+            if (separation)
+                agents->setSeparation(10.0f, 0.2f);
+            return [field, agents, goal, &pool]() { agents->update(*field, goal, 0.1f, pool); };
+        });
+    }
+}
+
+// circle_constraint's rope projection and the tentacles' FABRIK solve
+void addChainCases(BenchmarkSuite& suite) {
+    const size_t chainCount = 1000;
+    const size_t segmentCount = 16;
+    double segments = (double)(chainCount * segmentCount);
+
+    auto makeSolver = [chainCount, segmentCount]() {
+        auto solver = std::make_shared<ChainSolver>(chainCount, segmentCount, 5.f);
+        for (size_t chain = 0; chain < chainCount; chain++) {
+            for (size_t segment = 0; segment < segmentCount; segment++) {
+                solver->setPosition(chain, segment, sf::Vector2f(chain % 100 * 3.f, segment * 0.5f));
+            }
+        }
+        return solver;
+    };
+
+    std::string size = std::to_string(chainCount) + "x" + std::to_string(segmentCount);
+    suite.add("chains/follow/" + size, "segments", segments, 1000, [makeSolver, chainCount]() -> BenchmarkStep {
+        std::shared_ptr<ChainSolver> solver = makeSolver();
+        auto frame = std::make_shared<int>(0);
+        return [solver, frame, chainCount]() {
+            sf::Vector2f move(std::cos(*frame * 0.1f), std::sin(*frame * 0.1f) + 1.f);
+            for (size_t chain = 0; chain < chainCount; chain++) {
+                solver->setPosition(chain, 0, solver->getPosition(chain, 0) + move);
+            }
+            solver->solveFollow();
+            ++*frame;
+        };
+    });
+    suite.add("chains/fabrik4/" + size, "segments", segments, 200, [makeSolver, chainCount, segmentCount]() -> BenchmarkStep {
+        std::shared_ptr<ChainSolver> solver = makeSolver();
+        std::mt19937 random(1);
+        for (size_t chain = 0; chain < chainCount; chain++) {
+            solver->setBase(chain, solver->getPosition(chain, segmentCount - 1));
+            solver->setTarget(chain, sf::Vector2f((float)(random() % 300), (float)(random() % 300)));
+        }
+        return [solver]() { solver->solveFabrik(4); };
+    });
+}
+
+// The click-boxes scene with a shower of boxes, 30 steps in so they're all
+// falling and colliding
+std::shared_ptr<BoxScene> makeRainScene(int boxCount) {
+    auto scene = std::make_shared<BoxScene>(1);
+    scene->spawnRain(boxCount);
+    for (int i = 0; i < 30; i++) {
+        scene->step();
+    }
+    return scene;
+}
+
+void addBox2DCases(BenchmarkSuite& suite) {
+    const int boxCounts[] = {250, 1000};
+    for (int boxCount : boxCounts) {
+        suite.add("box2d/step/" + std::to_string(boxCount), "bodies", boxCount, 30, [boxCount]() -> BenchmarkStep {
+            std::shared_ptr<BoxScene> scene = makeRainScene(boxCount);
+            return [scene]() { b2World_Step(scene->getWorldId(), SCENE_TIME_STEP, SCENE_SUB_STEPS); };
+        });
+
+        // The same move events applied over and over, so only the sync is timed
+        suite.add("transformsync/update/" + std::to_string(boxCount), "bodies", boxCount, 1000, [boxCount]() -> BenchmarkStep {
+            std::shared_ptr<BoxScene> scene = makeRainScene(boxCount);
+            auto sync = std::make_shared<TransformSync>(SCALE);
+            for (uint32_t i = 0; i < scene->getBoxes().size(); i++) {
+                sync->setSlot(i, scene->getBoxes().getBody(i));
+            }
+            return [scene, sync]() { sync->update(scene->getWorldId()); };
+        });
+    }
+}
+
+int main(int argc, char** argv) {
+    // ./bench [--filter text] [--samples n] [--threads n] [--json path] [--baseline path] [--tolerance fraction]
+    std::string filter, jsonPath, baselinePath;
+    int samples = 5;
+    unsigned threads = 1;
+    double tolerance = 0.1;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+        std::string value = argv[i + 1];
+        if (option == "--filter") {
+            filter = value;
+        } else if (option == "--samples") {
+            samples = std::max(1, std::stoi(value));
+        } else if (option == "--threads") {
+            threads = (unsigned)std::stoul(value);
+        } else if (option == "--json") {
+            jsonPath = value;
+        } else if (option == "--baseline") {
+            baselinePath = value;
+        } else if (option == "--tolerance") {
+            tolerance = std::stod(value);
+        } else {
+            std::cerr << "Unknown option " << option << "\n";
+            return 2;
+        }
+    }
+    if (argc % 2 == 0) {
+        std::cerr << "Missing value for " << argv[argc - 1] << "\n";
+        return 2;
+    }
+
+    // One thread by default, so numbers don't depend on what else the
+    // machine is doing; 0 uses every core
+    ThreadPool pool(threads);
+
+    BenchmarkSuite suite;
+    suite.setFilter(filter);
+    suite.setSamples(samples);
+    addFlowFieldCases(suite);
+    addChainCases(suite);
+    addBox2DCases(suite);
+    addAgentCases(suite, pool);
+    suite.run();
+
+    if (!jsonPath.empty() && !suite.writeJson(jsonPath))
+        return 2;
+    if (baselinePath.empty())
+        return 0;
+
+    int regressions = suite.compare(baselinePath, tolerance);
+    if (regressions < 0)
+        return 2;
+    std::cout << regressions << " regression(s) beyond " << tolerance * 100.0 << "%\n";
+    return regressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,132 @@
+#include "BoxScene.hpp"
+
+#include "../common/Box2DProfile.hpp"
+
+namespace {
+
+b2WorldId createWorld(Box2DTaskScheduler* scheduler) {
+    b2WorldDef worldDef = b2DefaultWorldDef();
+    worldDef.gravity = (b2Vec2){0.0f, 10.0f};
+    if (scheduler)
+        scheduler->attach(worldDef);
+    return b2CreateWorld(&worldDef);
+}
+
+b2BodyId createGround(b2WorldId worldId) {
+    b2BodyDef groundBodyDef = b2DefaultBodyDef();
+    groundBodyDef.position = (b2Vec2){400.0f / SCALE, 550.0f / SCALE};
+    b2BodyId groundId = b2CreateBody(worldId, &groundBodyDef);
+
+    b2Polygon groundBox = b2MakeBox(400.0f / SCALE, 10.0f / SCALE);
+    b2ShapeDef groundShapeDef = b2DefaultShapeDef();
+    b2CreatePolygonShape(groundId, &groundShapeDef, &groundBox);
+    return groundId;
+}
+
+uint64_t hashBytes(uint64_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+} // namespace
+
+BoxScene::BoxScene(uint32_t seed, ThreadPool* pool)
+    : scheduler(pool ? new Box2DTaskScheduler(*pool) : nullptr), worldId(createWorld(scheduler.get())),
+      groundId(createGround(worldId)), query(worldId), boxes(SCALE), random(seed) {
+    boxArchetype = boxes.addArchetype(sf::Vector2f(60, 60), sf::Color::Blue);
+    boxPrefab = makeBoxPrefab(sf::Vector2f(60, 60), SCALE, b2_dynamicBody, boxArchetype);
+    boxPrefab.shapeDef.friction = 0.3f;
+
+    // The ground isn't pickable
+    b2BodyId ground = groundId;
+    query.setShapeFilter([ground](b2ShapeId shapeId) { return !B2_ID_EQUALS(b2Shape_GetBody(shapeId), ground); });
+}
+
+BoxScene::~BoxScene() {
+    b2DestroyWorld(worldId);
+}
+
+void BoxScene::spawnBox(float x, float y) {
+    b2Transform transform = {(b2Vec2){x / SCALE, y / SCALE}, b2Rot_identity};
+
+    // Box i's body carries slot i, so only boxes that moved get new transforms
+    spawnPrefab(worldId, boxPrefab, &transform, 1, &boxes);
+}
+
+bool BoxScene::removeBoxAt(float x, float y) {
+    b2Vec2 point = (b2Vec2){x / SCALE, y / SCALE};
+    uint32_t slot;
+    if (query.queryPoint(point, hits) == 0 || !TransformSync::slotOf(b2Body_GetUserData(hits[0].bodyId), slot))
+        return false;
+
+    // The last box takes over the removed box's slot
+    b2DestroyBody(boxes.getBody(slot));
+    boxes.remove(slot);
+    return true;
+}
+
+void BoxScene::spawnRain(int count) {
+    // Integer draws: std::uniform_*_distribution may differ between standard
+    // libraries, the raw engine output doesn't
+    spawnTransforms.clear();
+    for (int i = 0; i < count; i++) {
+        float x = 30.0f + (float)(random() % 740);
+        float y = -(float)(random() % 400);
+        spawnTransforms.push_back({(b2Vec2){x / SCALE, y / SCALE}, b2Rot_identity});
+    }
+    spawnPrefab(worldId, boxPrefab, spawnTransforms.data(), spawnTransforms.size(), &boxes);
+}
+
+size_t BoxScene::loadScene(const MappedScene& scene, BatchLayer& staticLayer) {
+    return spawnScene(scene, worldId, SCALE, boxes, &staticLayer);
+}
+
+void BoxScene::setProfiler(Profiler* value) {
+    profiler = value;
+    if (scheduler)
+        scheduler->setProfiler(value);
+}
+
+void BoxScene::step() {
+    {
+        PROFILE_SCOPE(profiler, "b2World_Step");
+        b2World_Step(worldId, SCENE_TIME_STEP, SCENE_SUB_STEPS);
+    }
+    ++stepCount;
+    if (profiler)
+        recordBox2DProfile(*profiler, worldId);
+
+    // Sleeping boxes cost nothing
+    PROFILE_SCOPE(profiler, "transform sync");
+    boxes.update(worldId);
+}
+
+uint64_t BoxScene::getChecksum() const {
+    uint64_t hash = 1469598103934665603ull;
+    for (uint32_t i = 0; i < boxes.size(); i++) {
+        b2Transform transform = b2Body_GetTransform(boxes.getBody(i));
+        hash = hashBytes(hash, &transform.p, sizeof(transform.p));
+        hash = hashBytes(hash, &transform.q, sizeof(transform.q));
+    }
+    return hash;
+}
+
+void BoxScene::getState(std::vector<float>& state) const {
+    state.resize(boxes.size() * STATE_FLOATS);
+    float* out = state.data();
+    for (uint32_t i = 0; i < boxes.size(); i++) {
+        b2BodyId bodyId = boxes.getBody(i);
+        b2Vec2 position = b2Body_GetPosition(bodyId);
+        b2Vec2 velocity = b2Body_GetLinearVelocity(bodyId);
+        out[0] = position.x;
+        out[1] = position.y;
+        out[2] = b2Rot_GetAngle(b2Body_GetRotation(bodyId));
+        out[3] = velocity.x;
+        out[4] = velocity.y;
+        out[5] = b2Body_GetAngularVelocity(bodyId);
+        out += STATE_FLOATS;
+    }
+}
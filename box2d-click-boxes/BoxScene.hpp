@@ -0,0 +1,82 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <box2d/box2d.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+#include "../common/BatchLayer.hpp"
+#include "../common/BodyPrefab.hpp"
+#include "../common/BodyRegistry.hpp"
+#include "../common/Box2DTasks.hpp"
+#include "../common/PhysicsQuery.hpp"
+#include "../common/Profiler.hpp"
+#include "../common/SceneFile.hpp"
+#include "../common/ThreadPool.hpp"
+#include "../common/TransformSync.hpp"
+
+// Scale factor for Box2D (meters) to SFML (pixels) conversion
+const float SCALE = 30.0f;
+
+const float SCENE_TIME_STEP = 1.0f / 60.0f;
+const int SCENE_SUB_STEPS = 4;
+
+// The click-boxes world without a window: ground, boxes and a fixed 60 Hz
+// step. Every change goes through the methods below and randomness comes
+// from the seed, so the same inputs at the same steps reproduce the same
+// session bit for bit (Box2D is deterministic, also across worker counts).
+class BoxScene {
+public:
+    // With a pool, Box2D's tasks run on it
+    explicit BoxScene(uint32_t seed, ThreadPool* pool = nullptr);
+    ~BoxScene();
+
+    BoxScene(const BoxScene&) = delete;
+    BoxScene& operator=(const BoxScene&) = delete;
+
+    // Positions in pixels
+    void spawnBox(float x, float y);
+    bool removeBoxAt(float x, float y);
+
+    // `count` boxes at seeded random spots above the ground, created in one
+    // batch
+    void spawnRain(int count);
+
+    // Add a level's bodies: static ones are drawn into `staticLayer`, the
+    // rest join the boxes. Returns how many bodies were created.
+    size_t loadScene(const MappedScene& scene, BatchLayer& staticLayer);
+
+    // One fixed step; the registry picks up the bodies that moved
+    void step();
+
+    // FNV-1a over every box's position and rotation bits, in box order
+    uint64_t getChecksum() const;
+
+    // Position, rotation and velocities of every box, STATE_FLOATS per box
+    static const int STATE_FLOATS = 6;
+    void getState(std::vector<float>& state) const;
+
+    // Time the step's phases (and Box2D's tasks) with `value`; null stops it
+    void setProfiler(Profiler* value);
+
+    b2WorldId getWorldId() const { return worldId; }
+    // Box i is registry index i
+    const BodyRegistry& getBoxes() const { return boxes; }
+    long getStepCount() const { return stepCount; }
+
+private:
+    std::unique_ptr<Box2DTaskScheduler> scheduler; // Outlives the world
+    b2WorldId worldId;
+    b2BodyId groundId;
+    PhysicsQuery query;
+    BodyRegistry boxes;
+    uint16_t boxArchetype;
+    BodyPrefab boxPrefab;
+    std::vector<QueryHit> hits;
+    std::vector<b2Transform> spawnTransforms;
+    std::mt19937 random;
+    Profiler* profiler = nullptr;
+    long stepCount = 0;
+};
@@ -0,0 +1,214 @@
+#include "SessionLog.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+const size_t FLUSH_SIZE = 64 * 1024;
+
+// Bounds-checked reads from the loaded log
+struct Reader {
+    const uint8_t* data;
+    size_t size;
+    size_t offset;
+
+    bool get(void* out, size_t count) {
+        if (size - offset < count)
+            return false;
+        std::memcpy(out, data + offset, count);
+        offset += count;
+        return true;
+    }
+};
+
+} // namespace
+
+void applySessionInput(BoxScene& scene, const SessionInput& input) {
+    switch (input.type) {
+    case SessionRecord::SpawnBox:
+        scene.spawnBox(input.x, input.y);
+        break;
+    case SessionRecord::RemoveBox:
+        scene.removeBoxAt(input.x, input.y);
+        break;
+    case SessionRecord::SpawnRain:
+        scene.spawnRain(input.count);
+        break;
+    default:
+        break;
+    }
+}
+
+SessionRecorder::~SessionRecorder() {
+    close();
+}
+
+bool SessionRecorder::open(const std::string& filePath, uint32_t seed, uint32_t interval) {
+    close();
+    file.open(filePath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "Failed to open session log " << filePath << "\n";
+        return false;
+    }
+    path = filePath;
+    keyframeInterval = interval;
+
+    SessionFileHeader header = {};
+    std::memcpy(header.magic, SESSION_FILE_MAGIC, sizeof(header.magic));
+    header.version = SESSION_FILE_VERSION;
+    header.seed = seed;
+    header.subStepCount = SCENE_SUB_STEPS;
+    header.keyframeInterval = keyframeInterval;
+    header.timeStep = SCENE_TIME_STEP;
+    put(&header, sizeof(header));
+    return true;
+}
+
+void SessionRecorder::close() {
+    if (!file.is_open())
+        return;
+    flush();
+    file.close();
+}
+
+void SessionRecorder::put(const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+void SessionRecorder::flush() {
+    file.write((const char*)buffer.data(), buffer.size());
+    buffer.clear();
+    if (!file)
+        std::cerr << "Failed to write session log " << path << "\n";
+}
+
+void SessionRecorder::recordInput(const SessionInput& input) {
+    if (!isOpen())
+        return;
+    put(&input.type, 1);
+    if (input.type == SessionRecord::SpawnRain) {
+        put(&input.count, sizeof(input.count));
+    } else {
+        put(&input.x, sizeof(input.x));
+        put(&input.y, sizeof(input.y));
+    }
+}
+
+void SessionRecorder::recordStep(const BoxScene& scene) {
+    if (!isOpen())
+        return;
+
+    SessionRecord type = SessionRecord::StepEnd;
+    uint64_t checksum = scene.getChecksum();
+    put(&type, 1);
+    put(&checksum, sizeof(checksum));
+
+    if (keyframeInterval > 0 && scene.getStepCount() % keyframeInterval == 0) {
+        type = SessionRecord::Keyframe;
+        scene.getState(state);
+        uint32_t boxCount = (uint32_t)scene.getBoxes().size();
+        put(&type, 1);
+        put(&boxCount, sizeof(boxCount));
+        put(state.data(), state.size() * sizeof(float));
+    }
+
+    if (buffer.size() >= FLUSH_SIZE)
+        flush();
+}
+
+bool replaySession(const std::string& path, ThreadPool* pool, ReplayResult& result) {
+    result = ReplayResult();
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        std::cerr << "Failed to open session log " << path << "\n";
+        return false;
+    }
+    std::vector<uint8_t> data((size_t)file.tellg());
+    file.seekg(0);
+    file.read((char*)data.data(), data.size());
+
+    Reader reader = {data.data(), data.size(), 0};
+    SessionFileHeader header;
+    if (!reader.get(&header, sizeof(header)) || std::memcmp(header.magic, SESSION_FILE_MAGIC, 4) != 0 ||
+        header.version != SESSION_FILE_VERSION) {
+        std::cerr << path << " is not a session log\n";
+        return false;
+    }
+    if (header.subStepCount != (uint32_t)SCENE_SUB_STEPS || header.timeStep != SCENE_TIME_STEP) {
+        std::cerr << path << " was recorded with a different step (" << header.timeStep << "s, "
+                  << header.subStepCount << " sub-steps)\n";
+        return false;
+    }
+
+    BoxScene scene(header.seed, pool);
+    std::vector<float> expected, actual;
+    auto start = std::chrono::steady_clock::now();
+
+    uint8_t tag;
+    while (reader.get(&tag, 1)) {
+        SessionInput input;
+        input.type = (SessionRecord)tag;
+        bool complete = true;
+
+        switch (input.type) {
+        case SessionRecord::SpawnBox:
+        case SessionRecord::RemoveBox:
+            complete = reader.get(&input.x, sizeof(input.x)) && reader.get(&input.y, sizeof(input.y));
+            if (complete)
+                applySessionInput(scene, input);
+            break;
+        case SessionRecord::SpawnRain:
+            complete = reader.get(&input.count, sizeof(input.count));
+            if (complete)
+                applySessionInput(scene, input);
+            break;
+        case SessionRecord::StepEnd: {
+            uint64_t checksum;
+            complete = reader.get(&checksum, sizeof(checksum));
+            if (!complete)
+                break;
+            scene.step();
+            ++result.steps;
+            if (scene.getChecksum() != checksum) {
+                if (result.firstDesyncStep < 0)
+                    result.firstDesyncStep = scene.getStepCount();
+                ++result.desyncedSteps;
+            }
+            break;
+        }
+        case SessionRecord::Keyframe: {
+            uint32_t boxCount;
+            // A torn count mustn't size a buffer bigger than the rest of the log
+            complete = reader.get(&boxCount, sizeof(boxCount)) &&
+                       boxCount <= (reader.size - reader.offset) / (BoxScene::STATE_FLOATS * sizeof(float));
+            if (!complete)
+                break;
+            expected.resize((size_t)boxCount * BoxScene::STATE_FLOATS);
+            complete = reader.get(expected.data(), expected.size() * sizeof(float));
+            if (!complete)
+                break;
+            scene.getState(actual);
+            ++result.keyframes;
+            result.keyframeMismatches += actual != expected;
+            break;
+        }
+        default:
+            std::cerr << path << ": unknown record " << (int)tag << " at byte " << reader.offset - 1 << "\n";
+            return false;
+        }
+
+        // A log cut short (e.g. the game was killed) still replays up to there
+        if (!complete) {
+            std::cerr << path << " ends mid-record after step " << result.steps << "\n";
+            break;
+        }
+    }
+
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.boxes = scene.getBoxes().size();
+    return true;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "BoxScene.hpp"
+
+// Recorded session: a fixed header, then a stream of tagged records. Inputs
+// belong to the next StepEnd, which carries the scene checksum after that
+// step; every keyframeInterval steps a Keyframe follows with the full box
+// state. Fields are written in the machine's byte order, like the flow
+// field files.
+const char SESSION_FILE_MAGIC[4] = {'B', 'X', 'R', 'C'};
+const uint32_t SESSION_FILE_VERSION = 1;
+
+struct SessionFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t seed;             // BoxScene seed
+    uint32_t subStepCount;     // Stored to catch a log from a differently built scene
+    uint32_t keyframeInterval;
+    float timeStep;
+};
+static_assert(sizeof(SessionFileHeader) == 24, "session file header must stay 24 bytes");
+
+enum class SessionRecord : uint8_t {
+    SpawnBox = 1,  // float x, float y
+    RemoveBox = 2, // float x, float y
+    SpawnRain = 3, // int32 count
+    StepEnd = 4,   // uint64 checksum
+    Keyframe = 5   // uint32 box count, then BoxScene::STATE_FLOATS floats per box
+};
+
+// One input, applied to the scene just before a step
+struct SessionInput {
+    SessionRecord type;
+    float x = 0.0f;
+    float y = 0.0f;
+    int32_t count = 0;
+};
+
+// Apply an input to the scene; live play and replay both go through here
+void applySessionInput(BoxScene& scene, const SessionInput& input);
+
+// Writes a session as it's played. Records are buffered and written in
+// blocks, so recording costs a few bytes per step.
+class SessionRecorder {
+public:
+    ~SessionRecorder();
+
+    bool open(const std::string& path, uint32_t seed, uint32_t keyframeInterval = 600);
+    void close();
+    bool isOpen() const { return file.is_open(); }
+
+    void recordInput(const SessionInput& input);
+
+    // Call after every BoxScene::step
+    void recordStep(const BoxScene& scene);
+
+private:
+    void put(const void* data, size_t size);
+    void flush();
+
+    std::ofstream file;
+    std::string path;
+    std::vector<uint8_t> buffer;
+    std::vector<float> state;
+    uint32_t keyframeInterval = 0;
+};
+
+struct ReplayResult {
+    long steps = 0;
+    double seconds = 0.0;         // Wall time of the replay
+    long desyncedSteps = 0;       // Steps whose checksum differed from the log
+    long firstDesyncStep = -1;
+    long keyframes = 0;
+    long keyframeMismatches = 0;
+    size_t boxes = 0;             // At the end
+};
+
+// Re-run a recorded session headless, as fast as it goes, checking every
+// step's checksum and every keyframe. Returns false if the file can't be
+// read; desyncs are reported in `result`.
+bool replaySession(const std::string& path, ThreadPool* pool, ReplayResult& result);
@@ -1,45 +1,588 @@
 #include <SFML/Graphics.hpp>
 #include <box2d/box2d.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
 #include <iostream>
+#include <random>
+#include <string>
 #include <vector>
+#include "BoxScene.hpp"
+#include "SessionLog.hpp"
+#include "../common/BatchLayer.hpp"
+#include "../common/Camera.hpp"
+#include "../common/GameLoop.hpp"
+#include "../common/ResourceCache.hpp"
 
-// Scale factor for Box2D (meters) to SFML (pixels) conversion
-const float SCALE = 30.0f;
+// Headless check of PhysicsQuery: nearest-box queries at random points in
+// worlds of growing size, against the scan over every body they replace.
+// The scan grows with the world, the broad-phase query should not. Both
+// must pick the same box for every point (or one just as close).
+int runQueryBenchmark(int maxBoxes, int queries) {
+    srand(1);
+    size_t mismatches = 0;
+    for (int boxCount = std::max(1, maxBoxes / 16); boxCount <= maxBoxes; boxCount *= 4) {
+        b2WorldDef worldDef = b2DefaultWorldDef();
+        b2WorldId worldId = b2CreateWorld(&worldDef);
 
-struct Box {
-    b2BodyId bodyId;
-    sf::RectangleShape shape;
-};
+        // Same density at every size: the world just gets wider
+        int columns = std::max(1, (int)std::sqrt((float)boxCount));
+        std::vector<b2BodyId> bodies;
+        for (int i = 0; i < boxCount; i++) {
+            b2BodyDef bodyDef = b2DefaultBodyDef();
+            bodyDef.position = (b2Vec2){(i % columns) * 3.0f, (i / columns) * 3.0f};
+            b2BodyId bodyId = b2CreateBody(worldId, &bodyDef);
+            b2Polygon box = b2MakeBox(1.0f, 1.0f);
+            b2ShapeDef shapeDef = b2DefaultShapeDef();
+            b2CreatePolygonShape(bodyId, &shapeDef, &box);
+            bodies.push_back(bodyId);
+        }
+
+        std::vector<b2Vec2> points;
+        for (int q = 0; q < queries; q++) {
+            points.push_back((b2Vec2){(rand() % (columns * 300)) / 100.0f, (rand() % (columns * 300)) / 100.0f});
+        }
+        const float radius = 5.0f;
+
+        std::vector<long> scanPicks(points.size());
+        std::vector<float> scanDistances(points.size());
+        auto start = std::chrono::steady_clock::now();
+        for (size_t q = 0; q < points.size(); q++) {
+            b2Vec2 point = points[q];
+            float best = radius;
+            long bestIndex = -1;
+            for (size_t i = 0; i < bodies.size(); i++) {
+                b2Vec2 pos = b2Body_GetPosition(bodies[i]);
+                float dist = std::hypot(point.x - pos.x, point.y - pos.y);
+                if (dist <= best) {
+                    best = dist;
+                    bestIndex = (long)i;
+                }
+            }
+            scanPicks[q] = bestIndex;
+            scanDistances[q] = best;
+        }
+        double scanUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        PhysicsQuery query(worldId);
+        std::vector<QueryHit> hits;
+        start = std::chrono::steady_clock::now();
+        std::vector<QueryHit> queryPicks(points.size());
+        std::vector<bool> queryFound(points.size());
+        for (size_t q = 0; q < points.size(); q++) {
+            queryFound[q] = query.queryNearest(points[q], 1, radius, hits) > 0;
+            if (queryFound[q])
+                queryPicks[q] = hits[0];
+        }
+        double queryUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        // Two boxes the same distance away are both right
+        size_t different = 0;
+        for (size_t q = 0; q < points.size(); q++) {
+            if (queryFound[q] != (scanPicks[q] >= 0))
+                different++;
+            else if (queryFound[q] && !B2_ID_EQUALS(queryPicks[q].bodyId, bodies[scanPicks[q]]) &&
+                     std::fabs(queryPicks[q].distance - scanDistances[q]) > 1e-4f)
+                different++;
+        }
+        mismatches += different;
+
+        std::cout << "boxes=" << boxCount << " scan=" << scanUs / queries << "us query=" << queryUs / queries
+                  << "us per pick, mismatches=" << different << "\n";
+        b2DestroyWorld(worldId);
+    }
+    return mismatches == 0 ? 0 : 1;
+}
+
+// Headless benchmark world: `count` 1 m boxes in rows of `columns` at a
+// 1.5 m pitch, stacked upwards from a ground box as wide as a row. With a
+// registry every box gets an entry (index i for box i); without one, box i
+// carries TransformSync slot i as its user data.
+std::vector<b2BodyId> makeBoxGrid(b2WorldId worldId, int count, int columns, float friction, BodyRegistry* registry = nullptr) {
+    float floorWidth = columns * 1.5f;
+    b2BodyDef groundDef = b2DefaultBodyDef();
+    groundDef.position = (b2Vec2){floorWidth / 2, 0.5f};
+    b2BodyId groundId = b2CreateBody(worldId, &groundDef);
+    b2Polygon groundBox = b2MakeBox(floorWidth / 2, 0.5f);
+    b2ShapeDef groundShapeDef = b2DefaultShapeDef();
+    b2CreatePolygonShape(groundId, &groundShapeDef, &groundBox);
+
+    uint16_t archetype = registry ? registry->addArchetype(sf::Vector2f(SCALE, SCALE), sf::Color::Blue) : 0;
+    BodyPrefab prefab = makeBoxPrefab(sf::Vector2f(SCALE, SCALE), SCALE, b2_dynamicBody, archetype);
+    prefab.shapeDef.friction = friction;
+
+    std::vector<b2Transform> transforms;
+    for (int i = 0; i < count; i++) {
+        transforms.push_back({(b2Vec2){(i % columns) * 1.5f + 0.75f, -0.5f - (i / columns) * 1.0f}, b2Rot_identity});
+    }
+    std::vector<b2BodyId> bodies;
+    spawnPrefab(worldId, prefab, transforms.data(), transforms.size(), registry, &bodies);
+    if (!registry) {
+        for (uint32_t i = 0; i < bodies.size(); i++) {
+            b2Body_SetUserData(bodies[i], TransformSync::slotUserData(i));
+        }
+    }
+    return bodies;
+}
+
+// Headless stress scene: `boxCount` boxes stacked 20 high on a wide floor,
+// stepped at 60 Hz with Box2D's tasks on 1, 2, 4... pool threads. Box2D is
+// deterministic across worker counts, so every run should end in the same
+// place.
+int runStressTest(int boxCount, unsigned maxThreads, int frames) {
+    const int stackHeight = 20;
+    int columns = (boxCount + stackHeight - 1) / stackHeight;
+    double singleThreadMs = 0.0;
+    double firstChecksum = 0.0;
+
+    // Box2D can't use more workers than this
+    maxThreads = std::min(maxThreads, Box2DTaskScheduler::MAX_WORKERS);
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        ThreadPool pool(threads);
+        Box2DTaskScheduler scheduler(pool);
+        b2WorldDef worldDef = b2DefaultWorldDef();
+        worldDef.gravity = (b2Vec2){0.0f, 10.0f};
+        scheduler.attach(worldDef);
+        b2WorldId worldId = b2CreateWorld(&worldDef);
+        std::vector<b2BodyId> bodies = makeBoxGrid(worldId, boxCount, columns, 0.3f);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; frame++) {
+            b2World_Step(worldId, 1.0f / 60.0f, 4);
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+
+        double checksum = 0.0;
+        for (b2BodyId bodyId : bodies) {
+            b2Vec2 pos = b2Body_GetPosition(bodyId);
+            checksum += pos.x + pos.y * 3.0;
+        }
+        if (threads == 1) {
+            singleThreadMs = ms;
+            firstChecksum = checksum;
+        }
+
+        std::cout << "boxes=" << boxCount << " threads=" << threads << " step=" << ms << "ms speedup="
+                  << singleThreadMs / ms << "x tasks/step=" << (double)scheduler.getTaskCount() / frames
+                  << " same result=" << (checksum == firstChecksum) << "\n";
+        b2DestroyWorld(worldId);
+    }
+    return 0;
+}
+
+// Headless sync check: a pile of `boxCount` boxes falls and settles. Per
+// frame, polling every body's transform is timed against TransformSync's
+// move events, once while the pile falls and once after it has settled,
+// when almost nothing moves.
+int runSyncBenchmark(int boxCount, int frames) {
+    b2WorldDef worldDef = b2DefaultWorldDef();
+    worldDef.gravity = (b2Vec2){0.0f, 10.0f};
+    b2WorldId worldId = b2CreateWorld(&worldDef);
+    std::vector<b2BodyId> bodies = makeBoxGrid(worldId, boxCount, 100, b2DefaultShapeDef().friction);
+
+    TransformSync sync(SCALE);
+    std::vector<RenderTransform> polled(bodies.size());
+    auto measure = [&](const char* phase) {
+        double pollUs = 0.0, syncUs = 0.0;
+        size_t movedTotal = 0;
+        for (int frame = 0; frame < frames; frame++) {
+            b2World_Step(worldId, 1.0f / 60.0f, 4);
+
+            auto start = std::chrono::steady_clock::now();
+            movedTotal += sync.update(worldId);
+            syncUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+            start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < bodies.size(); i++) {
+                b2Vec2 position = b2Body_GetPosition(bodies[i]);
+                b2Rot rotation = b2Body_GetRotation(bodies[i]);
+                polled[i].x = position.x * SCALE;
+                polled[i].y = position.y * SCALE;
+                polled[i].angle = b2Rot_GetAngle(rotation) * 180.0f / b2_pi;
+            }
+            pollUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        // Bodies that never moved keep their slot's default, so only compare
+        // slots the sync has seen
+        size_t mismatches = 0;
+        for (size_t i = 0; i < bodies.size() && i < sync.getSlotCount(); i++) {
+            const RenderTransform& synced = sync.getTransform((uint32_t)i);
+            mismatches += std::abs(synced.x - polled[i].x) > 0.01f || std::abs(synced.y - polled[i].y) > 0.01f;
+        }
+        std::cout << phase << ": boxes=" << boxCount << " moved/frame=" << movedTotal / frames << " poll=" << pollUs / frames
+                  << "us sync=" << syncUs / frames << "us mismatches=" << mismatches << "\n";
+    };
+
+    measure("falling");
+    for (int frame = 0; frame < 1200; frame++) {
+        b2World_Step(worldId, 1.0f / 60.0f, 4);
+        sync.update(worldId);
+    }
+    measure("settled");
+
+    b2DestroyWorld(worldId);
+    return 0;
+}
+
+// Headless layout check: `boxCount` boxes fall onto a wide floor, and the
+// per-frame sync and batch passes are timed for the old layout (a body id
+// plus an sf::RectangleShape per box) against the BodyRegistry's packed
+// components. Both read the same step's move events.
+int runRegistryBenchmark(int boxCount, int frames) {
+    b2WorldDef worldDef = b2DefaultWorldDef();
+    worldDef.gravity = (b2Vec2){0.0f, 10.0f};
+    b2WorldId worldId = b2CreateWorld(&worldDef);
+    BodyRegistry registry(SCALE);
+    std::vector<b2BodyId> bodies = makeBoxGrid(worldId, boxCount, 400, b2DefaultShapeDef().friction, &registry);
+
+    // The old layout over the same bodies; both use index i, so the
+    // registry's user data serves both syncs
+    struct ShapeBox {
+        b2BodyId bodyId;
+        sf::RectangleShape shape;
+    };
+    std::vector<ShapeBox> shapeBoxes;
+    TransformSync shapeSync(SCALE);
+    for (b2BodyId bodyId : bodies) {
+        b2Vec2 position = b2Body_GetPosition(bodyId);
+        sf::RectangleShape shape(sf::Vector2f(SCALE, SCALE));
+        shape.setFillColor(sf::Color::Blue);
+        shape.setOrigin(SCALE / 2, SCALE / 2);
+        shape.setPosition(position.x * SCALE, position.y * SCALE);
+        shapeBoxes.push_back({bodyId, shape});
+    }
+
+    BatchLayer layer;
+    double shapeUs = 0.0, registryUs = 0.0;
+    size_t moved = 0;
+    for (int frame = 0; frame < frames; frame++) {
+        b2World_Step(worldId, 1.0f / 60.0f, 4);
+
+        auto start = std::chrono::steady_clock::now();
+        shapeSync.update(worldId);
+        for (uint32_t slot : shapeSync.getMovedSlots()) {
+            const RenderTransform& transform = shapeSync.getTransform(slot);
+            shapeBoxes[slot].shape.setPosition(transform.x, transform.y);
+            shapeBoxes[slot].shape.setRotation(transform.angle);
+        }
+        layer.clear();
+        for (const ShapeBox& box : shapeBoxes) {
+            layer.addShape(box.shape);
+        }
+        shapeUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        moved += registry.update(worldId);
+        layer.clear();
+        registry.appendTo(layer);
+        registryUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // The shape's own vertex arrays live on the heap on top of this
+    std::cout << "boxes=" << boxCount << " moved/frame=" << moved / frames << "\n";
+    std::cout << "shapes: bytes/box=" << sizeof(ShapeBox) << "+heap sync+batch=" << shapeUs / frames << "us\n";
+    std::cout << "registry: bytes/box=" << BodyRegistry::getBytesPerBody() << " sync+batch=" << registryUs / frames << "us\n";
+
+    b2DestroyWorld(worldId);
+    return 0;
+}
+
+// Level for --scene: static floor pieces across a world `boxCount / 20`
+// columns wide, 20-pixel boxes stacked 20 high in every column and
+// `obstacleCount` static pegs at seeded heights in the gaps between them.
+// With `asleep` the stacks start settled.
+void makeLevel(int boxCount, int obstacleCount, bool asleep, std::vector<ScenePrefab>& prefabs, std::vector<SceneBody>& bodies) {
+    const int stackHeight = 20;
+    const float spacing = 30.0f / SCALE; // Column pitch, a 10-pixel gap
+    const float boxHalf = 10.0f / SCALE;
+    const float floorTop = 540.0f / SCALE;
+    int columns = std::max(1, (boxCount + stackHeight - 1) / stackHeight);
+    float worldWidth = columns * spacing;
+
+    prefabs = {
+        {400.0f / SCALE, 10.0f / SCALE, 0.0f, 0.6f, 0.0f, sf::Color::Green.toInteger(), b2_staticBody},      // Floor
+        {boxHalf, boxHalf, 1.0f, 0.3f, 0.0f, sf::Color::Blue.toInteger(), b2_dynamicBody},                   // Box
+        {4.0f / SCALE, 4.0f / SCALE, 0.0f, 0.6f, 0.0f, sf::Color(200, 60, 60).toInteger(), b2_staticBody},   // Peg
+    };
+    bodies.clear();
+    for (float x = 400.0f / SCALE; x - 400.0f / SCALE < worldWidth; x += 800.0f / SCALE) {
+        bodies.push_back({x, floorTop + 10.0f / SCALE, 0.0f, 0, 0});
+    }
+    uint16_t boxFlags = asleep ? SCENE_BODY_ASLEEP : 0;
+    for (int i = 0; i < boxCount; i++) {
+        float x = (i / stackHeight) * spacing + spacing / 2;
+        float y = floorTop - boxHalf - (i % stackHeight) * 2 * boxHalf;
+        bodies.push_back({x, y, 0.0f, 1, boxFlags});
+    }
+    std::mt19937 random(1);
+    for (int i = 0; i < obstacleCount; i++) {
+        float x = (float)(random() % columns) * spacing;
+        float y = floorTop - (float)(random() % 400) / SCALE;
+        bodies.push_back({x, y, 0.0f, 2, 0});
+    }
+}
+
+// ./game --make-scene: write makeLevel's level to `path`
+int runMakeScene(const std::string& path, int boxCount, int obstacleCount) {
+    std::vector<ScenePrefab> prefabs;
+    std::vector<SceneBody> bodies;
+    makeLevel(boxCount, obstacleCount, true, prefabs, bodies);
+    if (!saveSceneFile(path, prefabs, bodies, {}))
+        return 1;
+    std::cout << "wrote " << path << " bodies=" << bodies.size() << "\n";
+    return 0;
+}
+
+// Headless startup check: the same level built body by body the way the
+// demos used to (defs, polygon and an sf::RectangleShape per box), through
+// one prefab per kind into a registry, and from a scene file (settled, so
+// the stacks start asleep). Each is timed up to the end of the first step.
+// A cost grid rides along in the file to check it reads back intact.
+int runStartupBenchmark(int boxCount) {
+    auto elapsedMs = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+    int obstacleCount = boxCount / 4;
+    std::vector<ScenePrefab> prefabs;
+    std::vector<SceneBody> bodies;
+    makeLevel(boxCount, obstacleCount, false, prefabs, bodies);
+
+    auto firstStep = [&](b2WorldId worldId) {
+        auto start = std::chrono::steady_clock::now();
+        b2World_Step(worldId, SCENE_TIME_STEP, SCENE_SUB_STEPS);
+        return elapsedMs(start);
+    };
+    auto report = [&](const char* name, double createMs, double stepMs) {
+        std::cout << name << ": create=" << createMs << "ms first step=" << stepMs << "ms total=" << createMs + stepMs << "ms\n";
+    };
+    std::cout << "bodies=" << bodies.size() << "\n";
+
+    {
+        b2WorldDef worldDef = b2DefaultWorldDef();
+        worldDef.gravity = (b2Vec2){0.0f, 10.0f};
+        b2WorldId worldId = b2CreateWorld(&worldDef);
+        auto start = std::chrono::steady_clock::now();
+        std::vector<b2BodyId> ids;
+        std::vector<sf::RectangleShape> shapes;
+        for (const SceneBody& body : bodies) {
+            const ScenePrefab& prefab = prefabs[body.prefab];
+            b2BodyDef bodyDef = b2DefaultBodyDef();
+            bodyDef.type = (b2BodyType)prefab.bodyType;
+            bodyDef.position = (b2Vec2){body.x, body.y};
+            b2BodyId bodyId = b2CreateBody(worldId, &bodyDef);
+
+            b2Polygon box = b2MakeBox(prefab.halfWidth, prefab.halfHeight);
+            b2ShapeDef shapeDef = b2DefaultShapeDef();
+            shapeDef.density = prefab.density;
+            shapeDef.friction = prefab.friction;
+            b2CreatePolygonShape(bodyId, &shapeDef, &box);
+
+            ids.push_back(bodyId);
+            shapes.push_back(sf::RectangleShape(sf::Vector2f(prefab.halfWidth * 2 * SCALE, prefab.halfHeight * 2 * SCALE)));
+            shapes.back().setOrigin(prefab.halfWidth * SCALE, prefab.halfHeight * SCALE);
+            shapes.back().setFillColor(sf::Color(prefab.color));
+        }
+        double createMs = elapsedMs(start);
+        report("one at a time", createMs, firstStep(worldId));
+        b2DestroyWorld(worldId);
+    }
+
+    {
+        b2WorldDef worldDef = b2DefaultWorldDef();
+        worldDef.gravity = (b2Vec2){0.0f, 10.0f};
+        b2WorldId worldId = b2CreateWorld(&worldDef);
+        auto start = std::chrono::steady_clock::now();
+        BodyRegistry registry(SCALE);
+        BatchLayer staticLayer(BatchLayer::Static);
+        std::vector<b2Transform> transforms[3];
+        for (const SceneBody& body : bodies) {
+            transforms[body.prefab].push_back({(b2Vec2){body.x, body.y}, b2Rot_identity});
+        }
+        for (int kind = 0; kind < 3; kind++) {
+            BodyPrefab prefab = makePrefab(prefabs[kind], SCALE, registry);
+            spawnPrefab(worldId, prefab, transforms[kind].data(), transforms[kind].size(), &registry);
+        }
+        double createMs = elapsedMs(start);
+        report("prefab", createMs, firstStep(worldId));
+        b2DestroyWorld(worldId);
+    }
+
+    const std::string path = "startup.scn";
+    SceneGrid grid;
+    grid.width = grid.height = 256;
+    grid.cellSize = 20;
+    std::mt19937 random(1);
+    for (int i = 0; i < grid.width * grid.height; i++) {
+        grid.costs.push_back(random() % 8 == 0 ? 255 : 1 + random() % 4);
+    }
+    makeLevel(boxCount, obstacleCount, true, prefabs, bodies);
+    if (!saveSceneFile(path, prefabs, bodies, {grid}))
+        return 1;
+
+    b2WorldDef worldDef = b2DefaultWorldDef();
+    worldDef.gravity = (b2Vec2){0.0f, 10.0f};
+    b2WorldId worldId = b2CreateWorld(&worldDef);
+    auto start = std::chrono::steady_clock::now();
+    MappedScene scene;
+    if (!scene.open(path)) {
+        b2DestroyWorld(worldId);
+        return 1;
+    }
+    BodyRegistry registry(SCALE);
+    BatchLayer staticLayer(BatchLayer::Static);
+    size_t created = spawnScene(scene, worldId, SCALE, registry, &staticLayer);
+    double createMs = elapsedMs(start);
+    report("scene file", createMs, firstStep(worldId));
+
+    bool gridMatches = scene.getGridCount() == 1 && scene.getGrid(0).width == grid.width &&
+                       std::equal(grid.costs.begin(), grid.costs.end(), scene.getGridCosts(0));
+    std::cout << "file=" << scene.getFileSize() << " bytes created=" << created << " grid intact=" << (gridMatches ? "yes" : "no")
+              << "\n";
+    b2DestroyWorld(worldId);
+    return created == bodies.size() && gridMatches ? 0 : 1;
+}
+
+// Headless culling check: makeLevel's settled stacks, many windows wide,
+// with an 800x600 view panning across them. Per frame, batching every box
+// is timed against batching the boxes an AABB query on the view finds, and
+// every box whose centre is on screen must be among those.
+int runCullBenchmark(int boxCount, int frames) {
+    std::vector<ScenePrefab> prefabs;
+    std::vector<SceneBody> bodies;
+    makeLevel(boxCount, 0, true, prefabs, bodies);
+
+    b2WorldDef worldDef = b2DefaultWorldDef();
+    worldDef.gravity = (b2Vec2){0.0f, 10.0f};
+    b2WorldId worldId = b2CreateWorld(&worldDef);
+    BodyRegistry registry(SCALE);
+    BatchLayer staticLayer(BatchLayer::Static);
+    MappedScene scene;
+    const std::string path = "cull.scn";
+    if (!saveSceneFile(path, prefabs, bodies, {}) || !scene.open(path)) {
+        b2DestroyWorld(worldId);
+        return 1;
+    }
+    spawnScene(scene, worldId, SCALE, registry, &staticLayer);
+    float worldWidth = 0.0f;
+    for (const SceneBody& body : bodies) {
+        worldWidth = std::max(worldWidth, body.x * SCALE);
+    }
+
+    BatchLayer layer;
+    double allUs = 0.0, visibleUs = 0.0;
+    size_t drawn = 0, onScreen = 0, missed = 0;
+    for (int frame = 0; frame < frames; frame++) {
+        sf::FloatRect view(std::max(0.0f, worldWidth - 800.0f) * frame / std::max(1, frames - 1), 0.0f, 800.0f, 600.0f);
+
+        auto start = std::chrono::steady_clock::now();
+        layer.clear();
+        registry.appendTo(layer);
+        allUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        layer.clear();
+        drawn += registry.appendVisible(layer, worldId, view);
+        visibleUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        // getVisible() is sorted, so each on-screen box is a binary search
+        const std::vector<uint32_t>& visible = registry.getVisible();
+        for (uint32_t i = 0; i < registry.size(); i++) {
+            const RenderTransform& transform = registry.getTransform(i);
+            if (!view.contains(transform.x, transform.y))
+                continue;
+            ++onScreen;
+            missed += !std::binary_search(visible.begin(), visible.end(), i);
+        }
+    }
+
+    std::cout << "boxes=" << registry.size() << " world=" << worldWidth / 800.0f << " screens wide\n";
+    std::cout << "all: quads/frame=" << registry.size() << " batch=" << allUs / frames << "us\n";
+    std::cout << "culled: quads/frame=" << drawn / frames << " on screen=" << onScreen / frames << " cull+batch=" << visibleUs / frames
+              << "us missed=" << missed << "\n";
+    b2DestroyWorld(worldId);
+    return missed == 0 ? 0 : 1;
+}
+
+// Replay a recorded session headless and report how it compares to the log
+int runReplay(const std::string& path) {
+    ThreadPool pool(std::min(std::max(1u, std::thread::hardware_concurrency()), Box2DTaskScheduler::MAX_WORKERS));
+    ReplayResult result;
+    if (!replaySession(path, &pool, result))
+        return 1;
+
+    double recordedSeconds = result.steps * SCENE_TIME_STEP;
+    std::cout << "steps=" << result.steps << " boxes=" << result.boxes << " replay=" << result.seconds << "s ("
+              << recordedSeconds / std::max(result.seconds, 1e-9) << "x real time) desynced steps=" << result.desyncedSteps;
+    if (result.firstDesyncStep >= 0)
+        std::cout << " first desync at step " << result.firstDesyncStep;
+    std::cout << " keyframes=" << result.keyframes << " mismatched=" << result.keyframeMismatches << "\n";
+    return result.desyncedSteps == 0 && result.keyframeMismatches == 0 ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+    // ./game --replay path
+    if (argc > 2 && std::string(argv[1]) == "--replay") {
+        return runReplay(argv[2]);
+    }
+    // ./game --bench-registry [boxes] [frames]
+    if (argc > 1 && std::string(argv[1]) == "--bench-registry") {
+        return runRegistryBenchmark(argc > 2 ? std::stoi(argv[2]) : 100000, argc > 3 ? std::stoi(argv[3]) : 120);
+    }
+    // ./game --bench-sync [boxes] [frames]
+    if (argc > 1 && std::string(argv[1]) == "--bench-sync") {
+        return runSyncBenchmark(argc > 2 ? std::stoi(argv[2]) : 5000, argc > 3 ? std::stoi(argv[3]) : 120);
+    }
+    // ./game --stress [boxes] [maxThreads] [frames]
+    if (argc > 1 && std::string(argv[1]) == "--stress") {
+        unsigned maxThreads = argc > 3 ? (unsigned)std::stoi(argv[3]) : std::max(1u, std::thread::hardware_concurrency());
+        return runStressTest(argc > 2 ? std::stoi(argv[2]) : 20000, maxThreads, argc > 4 ? std::stoi(argv[4]) : 300);
+    }
+    // ./game --bench-cull [boxes] [frames]
+    if (argc > 1 && std::string(argv[1]) == "--bench-cull") {
+        return runCullBenchmark(argc > 2 ? std::stoi(argv[2]) : 100000, argc > 3 ? std::stoi(argv[3]) : 120);
+    }
+    // ./game --bench-startup [boxes]
+    if (argc > 1 && std::string(argv[1]) == "--bench-startup") {
+        return runStartupBenchmark(argc > 2 ? std::stoi(argv[2]) : 20000);
+    }
+    // ./game --make-scene path [boxes] [obstacles]
+    if (argc > 2 && std::string(argv[1]) == "--make-scene") {
+        return runMakeScene(argv[2], argc > 3 ? std::stoi(argv[3]) : 20000, argc > 4 ? std::stoi(argv[4]) : 5000);
+    }
+    // ./game --bench-query [boxes] [queries]
+    if (argc > 1 && std::string(argv[1]) == "--bench-query") {
+        return runQueryBenchmark(argc > 2 ? std::stoi(argv[2]) : 64000, argc > 3 ? std::stoi(argv[3]) : 1000);
+    }
 
-int main() {
     // Create SFML window
     sf::RenderWindow window(sf::VideoMode(800, 600), "SFML & Box2D");
 
-    // Load font
-    sf::Font font;
-    if (!font.loadFromFile("/System/Library/Fonts/Supplemental/Arial.ttf")) {
-        std::cerr << "Could not load font!\n";
-        return -1;
-    }
+    // The UI font loads in the background; text uses the built-in one until then
+    ResourceCache resources;
+    FontHandle font = resources.requestFont(defaultFontPaths());
 
     // Create text
-    sf::Text text("Click to spawn a box!", font, 20);
+    sf::Text text("Click to spawn a box!", resources.getFont(font), 20);
     text.setFillColor(sf::Color::White);
     text.setPosition(10, 10);
 
-    // Set up Box2D world
-    b2WorldDef worldDef = b2DefaultWorldDef();
-    worldDef.gravity = (b2Vec2){0.0f, 10.0f};
-    b2WorldId worldId = b2CreateWorld(&worldDef);
+    // The world steps at a fixed 60 Hz on the pool, so a recorded session
+    // replays exactly. Threads past Box2D's worker limit would only wait.
+    ThreadPool pool(std::min(std::max(1u, std::thread::hardware_concurrency()), Box2DTaskScheduler::MAX_WORKERS));
+    uint32_t seed = (uint32_t)std::chrono::steady_clock::now().time_since_epoch().count();
+    BoxScene scene(seed, &pool);
 
-    // Create a Box2D ground body
-    b2BodyDef groundBodyDef = b2DefaultBodyDef();
-    groundBodyDef.position = (b2Vec2){400.0f / SCALE, 550.0f / SCALE};
-    b2BodyId groundId = b2CreateBody(worldId, &groundBodyDef);
+    // P shows the profiler overlay, T records a Chrome trace, C a CSV
+    Profiler profiler;
+    scene.setProfiler(&profiler);
+    bool showProfile = false;
 
-    b2Polygon groundBox = b2MakeBox(400.0f / SCALE, 10.0f / SCALE);
-    b2ShapeDef groundShapeDef = b2DefaultShapeDef();
-    b2CreatePolygonShape(groundId, &groundShapeDef, &groundBox);
+    // ./game --record path
+    SessionRecorder recorder;
+    if (argc > 2 && std::string(argv[1]) == "--record" && !recorder.open(argv[2], seed))
+        return 1;
 
     // Create an SFML rectangle for the ground
     sf::RectangleShape groundRect(sf::Vector2f(800, 20));
@@ -47,70 +590,123 @@ int main() {
     groundRect.setOrigin(400, 10);
     groundRect.setPosition(400, 550);
 
-    // Store dynamic boxes
-    std::vector<Box> boxes;
+    // The ground is uploaded once; boxes are re-batched into one draw per frame
+    BatchLayer staticLayer(BatchLayer::Static);
+    staticLayer.addShape(groundRect);
+    BatchLayer boxLayer;
+
+    // ./game --scene path: start with a level's bodies
+    if (argc > 2 && std::string(argv[1]) == "--scene") {
+        auto start = std::chrono::steady_clock::now();
+        MappedScene level;
+        if (!level.open(argv[2]))
+            return 1;
+        size_t created = scene.loadScene(level, staticLayer);
+        std::cout << "loaded " << created << " bodies in "
+                  << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() << "ms\n";
+    }
 
-    // Physics step settings
-    int subStepCount = 4;
-    sf::Clock clock;
+    // Inputs wait for the next step so they land on a step boundary
+    std::vector<SessionInput> pending;
+    GameLoop loop(SCENE_TIME_STEP);
+
+    // Middle drag, the wheel and the arrow keys move around levels wider
+    // than the window; only boxes in view are batched
+    Camera camera(sf::Vector2f(800, 600));
+    sf::Clock frameClock;
 
     // Main loop
     while (window.isOpen()) {
+        profiler.beginFrame();
         sf::Event event;
-        while (window.pollEvent(event)) {
-            if (event.type == sf::Event::Closed)
-                window.close();
-
-            // Spawn new box on mouse click
-            if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
-                float mouseX = event.mouseButton.x;
-                float mouseY = event.mouseButton.y;
-
-                // Create Box2D body
-                b2BodyDef bodyDef = b2DefaultBodyDef();
-                bodyDef.type = b2_dynamicBody;
-                bodyDef.position = (b2Vec2){mouseX / SCALE, mouseY / SCALE};
-                b2BodyId bodyId = b2CreateBody(worldId, &bodyDef);
-
-                b2Polygon dynamicBox = b2MakeBox(30.0f / SCALE, 30.0f / SCALE);
-                b2ShapeDef shapeDef = b2DefaultShapeDef();
-                shapeDef.density = 1.0f;
-                shapeDef.friction = 0.3f;
-                b2CreatePolygonShape(bodyId, &shapeDef, &dynamicBox);
-
-                // Create SFML shape for visualization
-                sf::RectangleShape shape(sf::Vector2f(60, 60));
-                shape.setFillColor(sf::Color::Blue);
-                shape.setOrigin(30, 30);
-                shape.setPosition(mouseX, mouseY);
-
-                // Store the new box
-                boxes.push_back({bodyId, shape});
+        {
+            PROFILE_SCOPE(profiler, "events");
+            while (window.pollEvent(event)) {
+                if (event.type == sf::Event::Closed)
+                    window.close();
+                if (camera.handleEvent(event, window))
+                    continue;
+
+                // Left click spawns a box, right click removes the box under
+                // the cursor; sessions log world coordinates
+                if (event.type == sf::Event::MouseButtonPressed) {
+                    sf::Vector2f at = camera.toWorld(sf::Vector2i(event.mouseButton.x, event.mouseButton.y), window);
+                    if (event.mouseButton.button == sf::Mouse::Left)
+                        pending.push_back({SessionRecord::SpawnBox, at.x, at.y});
+                    if (event.mouseButton.button == sf::Mouse::Right)
+                        pending.push_back({SessionRecord::RemoveBox, at.x, at.y});
+                }
+
+                // R drops a shower of boxes at seeded random spots
+                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::R) {
+                    SessionInput rain = {SessionRecord::SpawnRain};
+                    rain.count = 20;
+                    pending.push_back(rain);
+                }
+
+                // P toggles the overlay, T a Chrome trace, C a CSV; the
+                // profiler only runs while one of them wants it
+                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::P) {
+                    showProfile = !showProfile;
+                    if (!showProfile)
+                        text.setString("Click to spawn a box!");
+                }
+                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::T) {
+                    if (profiler.isTracing())
+                        profiler.stopTrace();
+                    else
+                        profiler.startTrace("trace.json");
+                }
+                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::C) {
+                    if (profiler.isWritingCsv())
+                        profiler.stopCsv();
+                    else
+                        profiler.startCsv("profile.csv");
+                }
             }
         }
+        profiler.setEnabled(showProfile || profiler.isTracing() || profiler.isWritingCsv());
 
-        // Box2D physics step
-        float timeStep = clock.restart().asSeconds();
-        b2World_Step(worldId, timeStep, subStepCount);
+        // Box2D physics steps; a long frame runs at most a few to catch up
+        {
+            PROFILE_SCOPE(profiler, "physics");
+            for (int steps = loop.advance(); steps > 0; --steps) {
+                for (const SessionInput& input : pending) {
+                    applySessionInput(scene, input);
+                    recorder.recordInput(input);
+                }
+                pending.clear();
 
-        // Update all boxes
-        for (auto& box : boxes) {
-            b2Vec2 position = b2Body_GetPosition(box.bodyId);
-            b2Rot rotation = b2Body_GetRotation(box.bodyId);
-            box.shape.setPosition(position.x * SCALE, position.y * SCALE);
-            box.shape.setRotation(b2Rot_GetAngle(rotation) * 180.0f / b2_pi);
+                scene.step();
+                recorder.recordStep(scene);
+            }
         }
 
+        camera.update(frameClock.restart().asSeconds());
+        resources.update();
+        text.setFont(resources.getFont(font));
+
         // Render scene
-        window.clear();
-        window.draw(text);
-        window.draw(groundRect);
-        for (const auto& box : boxes) {
-            window.draw(box.shape);
+        if (showProfile)
+            text.setString(profiler.formatOverlay());
+        {
+            PROFILE_SCOPE(profiler, "draw");
+            window.clear();
+            window.setView(camera.getView());
+            window.draw(staticLayer);
+            boxLayer.clear();
+            scene.getBoxes().appendVisible(boxLayer, scene.getWorldId(), camera.getVisibleRect(), loop.getAlpha());
+            window.draw(boxLayer);
+            window.setView(window.getDefaultView());
+            window.draw(text);
         }
-        window.display();
+        {
+            PROFILE_SCOPE(profiler, "display");
+            window.display();
+        }
+        profiler.endFrame();
+        loop.pace();
     }
 
-    b2DestroyWorld(worldId);
     return 0;
 }
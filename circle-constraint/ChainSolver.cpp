@@ -0,0 +1,131 @@
+#include "ChainSolver.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include "../common/SimdLanes.hpp"
+
+namespace
+{
+
+// Below this, a link has no usable direction and its segment stays put
+const float MIN_DISTANCE = 1e-6f;
+
+}
+
+ChainSolver::ChainSolver(size_t chainCount, size_t segmentCount, float linkLength)
+    : chainCount(chainCount), segmentCount(std::max<size_t>(segmentCount, 1)),
+      xs(chainCount * this->segmentCount, 0.f), ys(chainCount * this->segmentCount, 0.f),
+      lengths(chainCount * this->segmentCount, linkLength),
+      targetX(chainCount, 0.f), targetY(chainCount, 0.f), baseX(chainCount, 0.f), baseY(chainCount, 0.f)
+{
+}
+
+void ChainSolver::setLinkLength(size_t chain, size_t segment, float length)
+{
+    lengths[segment * chainCount + chain] = length;
+}
+
+void ChainSolver::setPosition(size_t chain, size_t segment, sf::Vector2f position)
+{
+    xs[segment * chainCount + chain] = position.x;
+    ys[segment * chainCount + chain] = position.y;
+}
+
+sf::Vector2f ChainSolver::getPosition(size_t chain, size_t segment) const
+{
+    return sf::Vector2f(xs[segment * chainCount + chain], ys[segment * chainCount + chain]);
+}
+
+void ChainSolver::resetChain(size_t chain, sf::Vector2f position)
+{
+    for (size_t segment = 0; segment < segmentCount; segment++)
+    {
+        setPosition(chain, segment, position);
+    }
+    targetX[chain] = baseX[chain] = position.x;
+    targetY[chain] = baseY[chain] = position.y;
+}
+
+void ChainSolver::setTarget(size_t chain, sf::Vector2f target)
+{
+    targetX[chain] = target.x;
+    targetY[chain] = target.y;
+}
+
+void ChainSolver::setBase(size_t chain, sf::Vector2f base)
+{
+    baseX[chain] = base.x;
+    baseY[chain] = base.y;
+}
+
+void ChainSolver::solveFollow()
+{
+    for (size_t segment = 1; segment < segmentCount; segment++)
+    {
+        projectRow(segment - 1, segment, segment, true);
+    }
+}
+
+void ChainSolver::solveFabrik(int iterations)
+{
+    size_t tail = segmentCount - 1;
+    for (int i = 0; i < iterations; i++)
+    {
+        // Backward: head onto its target, every other segment follows it
+        std::copy(targetX.begin(), targetX.end(), xs.begin());
+        std::copy(targetY.begin(), targetY.end(), ys.begin());
+        for (size_t segment = 1; segment < segmentCount; segment++)
+        {
+            projectRow(segment - 1, segment, segment, false);
+        }
+
+        // Forward: tail back onto its base, walking towards the head
+        std::copy(baseX.begin(), baseX.end(), xs.begin() + tail * chainCount);
+        std::copy(baseY.begin(), baseY.end(), ys.begin() + tail * chainCount);
+        for (size_t segment = tail; segment > 0; segment--)
+        {
+            projectRow(segment, segment - 1, segment, false);
+        }
+    }
+}
+
+void ChainSolver::projectRow(size_t anchor, size_t target, size_t lengthRow, bool slack)
+{
+    const float* ax = &xs[anchor * chainCount];
+    const float* ay = &ys[anchor * chainCount];
+    float* tx = &xs[target * chainCount];
+    float* ty = &ys[target * chainCount];
+    const float* length = &lengths[lengthRow * chainCount];
+
+    // target = anchor + (target - anchor) * scale, where scale puts the target
+    // on its circle (capped at 1 with slack, so short links are left alone)
+    const float maxScale = slack ? 1.f : INFINITY;
+    size_t chain = 0;
+
+#if defined(SIMD_LANES_ENABLED)
+    using namespace simd;
+    const Lanes minDistance = splat(MIN_DISTANCE);
+    const Lanes scaleCap = splat(maxScale);
+    for (; chain + LANES <= chainCount; chain += LANES)
+    {
+        Lanes anchorX = load(ax + chain);
+        Lanes anchorY = load(ay + chain);
+        Lanes dx = sub(load(tx + chain), anchorX);
+        Lanes dy = sub(load(ty + chain), anchorY);
+        Lanes distance = max(sqrt(add(mul(dx, dx), mul(dy, dy))), minDistance);
+        Lanes scale = min(div(load(length + chain), distance), scaleCap);
+        store(tx + chain, add(anchorX, mul(dx, scale)));
+        store(ty + chain, add(anchorY, mul(dy, scale)));
+    }
+#endif
+
+    for (; chain < chainCount; chain++)
+    {
+        float dx = tx[chain] - ax[chain];
+        float dy = ty[chain] - ay[chain];
+        float distance = std::max(std::sqrt(dx * dx + dy * dy), MIN_DISTANCE);
+        float scale = std::min(length[chain] / distance, maxScale);
+        tx[chain] = ax[chain] + dx * scale;
+        ty[chain] = ay[chain] + dy * scale;
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <vector>
+
+// Bulk distance-constraint solver for many chains of the same segment count
+// (tentacles, ropes, snakes). Positions, link lengths and the per-chain
+// targets live in plain float arrays laid out segment-major:
+//
+//     x[segment * chainCount + chain]
+//
+// so one segment of every chain is contiguous and each projection step runs
+// across chains in SIMD lanes. Segment 0 is the head. The solver knows
+// nothing about drawing; callers read positions back with getX/getY.
+class ChainSolver
+{
+public:
+    ChainSolver(size_t chainCount, size_t segmentCount, float linkLength);
+
+    size_t getChainCount() const { return chainCount; }
+    size_t getSegmentCount() const { return segmentCount; }
+
+    // Length of the link between segment - 1 and segment (segment >= 1)
+    void setLinkLength(size_t chain, size_t segment, float length);
+    float getLinkLength(size_t chain, size_t segment) const { return lengths[segment * chainCount + chain]; }
+
+    void setPosition(size_t chain, size_t segment, sf::Vector2f position);
+    sf::Vector2f getPosition(size_t chain, size_t segment) const;
+
+    // Put every segment of a chain on one point (they spread out on the next solve)
+    void resetChain(size_t chain, sf::Vector2f position);
+
+    // Rope: each segment is pulled after the one before it only when its
+    // link is stretched, the same projection circle_constraint did
+    void solveFollow();
+
+    // Where the FABRIK solve should put each chain's head and tail
+    void setTarget(size_t chain, sf::Vector2f target);
+    void setBase(size_t chain, sf::Vector2f base);
+
+    // FABRIK: a backward pass from the head at its target and a forward pass
+    // from the tail at its base, per iteration. Links end up exactly at
+    // their lengths; heads reach targets that are within the chain's reach.
+    void solveFabrik(int iterations);
+
+    // Segment `segment` of every chain, for rendering
+    const float* getX(size_t segment) const { return &xs[segment * chainCount]; }
+    const float* getY(size_t segment) const { return &ys[segment * chainCount]; }
+
+private:
+    // Move row `target` onto circles of the link lengths around row `anchor`.
+    // With slack, only rows further than their length are moved.
+    void projectRow(size_t anchor, size_t target, size_t lengthRow, bool slack);
+
+    size_t chainCount;
+    size_t segmentCount;
+    std::vector<float> xs;
+    std::vector<float> ys;
+    std::vector<float> lengths; // Row 0 unused: link s joins segments s - 1 and s
+    std::vector<float> targetX, targetY;
+    std::vector<float> baseX, baseY;
+};
@@ -0,0 +1,204 @@
+#include "Cloth.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace
+{
+
+// Items per thread-pool chunk
+const size_t PARTICLE_CHUNK = 4096;
+const size_t CONSTRAINT_CHUNK = 2048;
+
+}
+
+void Cloth::buildGrid(int columns, int rows, float spacing, sf::Vector2f origin, bool shear)
+{
+    size_t first = xs.size();
+    auto at = [&](int column, int row) { return first + (size_t)row * columns + column; };
+
+    for (int row = 0; row < rows; row++)
+    {
+        for (int column = 0; column < columns; column++)
+        {
+            addParticle(origin + sf::Vector2f(column * spacing, row * spacing));
+        }
+    }
+
+    float diagonal = spacing * std::sqrt(2.f);
+    for (int row = 0; row < rows; row++)
+    {
+        for (int column = 0; column < columns; column++)
+        {
+            if (column + 1 < columns)
+                addConstraint(at(column, row), at(column + 1, row), spacing);
+            if (row + 1 < rows)
+                addConstraint(at(column, row), at(column, row + 1), spacing);
+            if (shear && column + 1 < columns && row + 1 < rows)
+            {
+                addConstraint(at(column, row), at(column + 1, row + 1), diagonal);
+                addConstraint(at(column + 1, row), at(column, row + 1), diagonal);
+            }
+        }
+    }
+}
+
+size_t Cloth::addParticle(sf::Vector2f position, bool pinned)
+{
+    xs.push_back(position.x);
+    ys.push_back(position.y);
+    prevXs.push_back(position.x);
+    prevYs.push_back(position.y);
+    inverseMass.push_back(pinned ? 0.f : 1.f);
+    return xs.size() - 1;
+}
+
+void Cloth::addConstraint(size_t a, size_t b)
+{
+    float dx = xs[b] - xs[a];
+    float dy = ys[b] - ys[a];
+    addConstraint(a, b, std::sqrt(dx * dx + dy * dy));
+}
+
+void Cloth::addConstraint(size_t a, size_t b, float length)
+{
+    constraintA.push_back((uint32_t)a);
+    constraintB.push_back((uint32_t)b);
+    restLength.push_back(length);
+    coloured = false;
+}
+
+void Cloth::setPinned(size_t particle, bool pinned)
+{
+    inverseMass[particle] = pinned ? 0.f : 1.f;
+}
+
+void Cloth::setPosition(size_t particle, sf::Vector2f position)
+{
+    xs[particle] = prevXs[particle] = position.x;
+    ys[particle] = prevYs[particle] = position.y;
+}
+
+void Cloth::colourConstraints()
+{
+    // Greedy colouring: each constraint takes the lowest colour neither of
+    // its particles has used yet. A grid needs 4 colours, 8 with shear.
+    std::vector<uint64_t> usedColours(xs.size(), 0);
+    std::vector<uint32_t> colour(constraintA.size());
+    uint32_t colourCount = 0;
+    for (size_t i = 0; i < constraintA.size(); i++)
+    {
+        uint64_t used = usedColours[constraintA[i]] | usedColours[constraintB[i]];
+        uint32_t c = 0;
+        while (c < 63 && (used & (1ull << c)))
+            c++;
+        // Past 63 colours everything left shares the last one, which is then
+        // solved serially (see step)
+        colour[i] = c;
+        usedColours[constraintA[i]] |= 1ull << c;
+        usedColours[constraintB[i]] |= 1ull << c;
+        colourCount = std::max(colourCount, c + 1);
+    }
+
+    // Stable counting sort by colour keeps each colour in build order
+    colourStart.assign(colourCount + 1, 0);
+    for (uint32_t c : colour)
+    {
+        colourStart[c + 1]++;
+    }
+    for (size_t c = 1; c < colourStart.size(); c++)
+    {
+        colourStart[c] += colourStart[c - 1];
+    }
+
+    std::vector<uint32_t> cursor(colourStart.begin(), colourStart.end() - 1);
+    std::vector<uint32_t> sortedA(constraintA.size()), sortedB(constraintB.size());
+    std::vector<float> sortedLength(restLength.size());
+    for (size_t i = 0; i < colour.size(); i++)
+    {
+        uint32_t slot = cursor[colour[i]]++;
+        sortedA[slot] = constraintA[i];
+        sortedB[slot] = constraintB[i];
+        sortedLength[slot] = restLength[i];
+    }
+    constraintA.swap(sortedA);
+    constraintB.swap(sortedB);
+    restLength.swap(sortedLength);
+    coloured = true;
+}
+
+void Cloth::step(float dt, ThreadPool& pool)
+{
+    if (!coloured)
+        colourConstraints();
+
+    pool.parallelFor(xs.size(), PARTICLE_CHUNK, [&](size_t begin, size_t end, unsigned)
+    {
+        integrate(begin, end, dt);
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    size_t colourCount = getColourCount();
+    for (int iteration = 0; iteration < iterations; iteration++)
+    {
+        for (size_t c = 0; c < colourCount; c++)
+        {
+            size_t begin = colourStart[c], end = colourStart[c + 1];
+            if (c == 63)
+            {
+                // Overflow colour may share particles: no parallelism
+                solveRange(begin, end);
+                continue;
+            }
+            pool.parallelFor(end - begin, CONSTRAINT_CHUNK, [&](size_t first, size_t last, unsigned)
+            {
+                solveRange(begin + first, begin + last);
+            });
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    constraintsPerSecond = seconds > 0.0 ? constraintA.size() * (double)iterations / seconds : 0.0;
+}
+
+void Cloth::integrate(size_t begin, size_t end, float dt)
+{
+    float ax = gravity.x * dt * dt;
+    float ay = gravity.y * dt * dt;
+    for (size_t i = begin; i < end; i++)
+    {
+        // Pinned particles have no inverse mass and stay where they are
+        float weight = inverseMass[i];
+        float x = xs[i], y = ys[i];
+        xs[i] = x + ((x - prevXs[i]) * damping + ax) * weight;
+        ys[i] = y + ((y - prevYs[i]) * damping + ay) * weight;
+        prevXs[i] = x;
+        prevYs[i] = y;
+    }
+}
+
+void Cloth::solveRange(size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        uint32_t a = constraintA[i], b = constraintB[i];
+        float weightA = inverseMass[a], weightB = inverseMass[b];
+        float totalWeight = weightA + weightB;
+        if (totalWeight <= 0.f)
+            continue;
+
+        float dx = xs[b] - xs[a];
+        float dy = ys[b] - ys[a];
+        float distance = std::sqrt(dx * dx + dy * dy);
+        if (distance <= 1e-6f)
+            continue;
+
+        // Split the correction by inverse mass: pinned ends don't move
+        float correction = (distance - restLength[i]) / (distance * totalWeight);
+        xs[a] += dx * correction * weightA;
+        ys[a] += dy * correction * weightA;
+        xs[b] -= dx * correction * weightB;
+        ys[b] -= dy * correction * weightB;
+    }
+}
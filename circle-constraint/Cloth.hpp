@@ -0,0 +1,76 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../common/ThreadPool.hpp"
+
+// Position-based Verlet cloth / soft body: particles with two-sided distance
+// constraints, solved with a fixed number of relaxation iterations per step.
+//
+// Constraints are greedily graph-coloured so no two constraints of a colour
+// share a particle, then stored sorted by colour. Each colour is one
+// parallelFor over the pool with no locks, and since colours run in a fixed
+// order the result is the same for any thread count.
+class Cloth
+{
+public:
+    Cloth() = default;
+
+    // Rectangular sheet, spacing apart, row-major particles starting at
+    // origin. Structural links always; shear diagonals if `shear`.
+    void buildGrid(int columns, int rows, float spacing, sf::Vector2f origin, bool shear);
+
+    size_t addParticle(sf::Vector2f position, bool pinned = false);
+
+    // Rest length is the particles' current distance unless given
+    void addConstraint(size_t a, size_t b);
+    void addConstraint(size_t a, size_t b, float restLength);
+
+    void setPinned(size_t particle, bool pinned);
+
+    // Teleport a particle without giving it velocity (e.g. dragging a pin)
+    void setPosition(size_t particle, sf::Vector2f position);
+    sf::Vector2f getPosition(size_t particle) const { return sf::Vector2f(xs[particle], ys[particle]); }
+
+    void setIterations(int count) { iterations = count; }
+    void setGravity(sf::Vector2f value) { gravity = value; }
+    void setDamping(float value) { damping = value; }
+
+    // Integrate one step of dt seconds, then relax every constraint
+    void step(float dt, ThreadPool& pool);
+
+    size_t getParticleCount() const { return xs.size(); }
+    size_t getConstraintCount() const { return constraintA.size(); }
+    size_t getColourCount() const { return colourStart.empty() ? 0 : colourStart.size() - 1; }
+    const float* getX() const { return xs.data(); }
+    const float* getY() const { return ys.data(); }
+
+    // Endpoints of constraint i (in colour order), for drawing links
+    uint32_t getConstraintA(size_t i) const { return constraintA[i]; }
+    uint32_t getConstraintB(size_t i) const { return constraintB[i]; }
+
+    // Constraint projections per second during the last step's relaxation
+    double getConstraintsPerSecond() const { return constraintsPerSecond; }
+
+private:
+    void colourConstraints();
+    void integrate(size_t begin, size_t end, float dt);
+    void solveRange(size_t begin, size_t end);
+
+    std::vector<float> xs, ys;
+    std::vector<float> prevXs, prevYs;
+    std::vector<float> inverseMass; // 0 for pinned particles
+
+    // Sorted by colour once coloured; colourStart[c] .. colourStart[c + 1] is colour c
+    std::vector<uint32_t> constraintA, constraintB;
+    std::vector<float> restLength;
+    std::vector<uint32_t> colourStart;
+    bool coloured = false;
+
+    int iterations = 8;
+    sf::Vector2f gravity = sf::Vector2f(0.f, 980.f);
+    float damping = 0.99f;
+    double constraintsPerSecond = 0.0;
+};
@@ -1,5 +1,31 @@
 #include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
 #include <vector>
+#include "ChainSolver.hpp"
+#include "Cloth.hpp"
+#include "../common/BatchLayer.hpp"
+#include "../common/GameLoop.hpp"
+
+// Tentacles reaching for the mouse from the bottom of the window
+const size_t TENTACLE_COUNT = 48;
+const size_t TENTACLE_SEGMENTS = 40;
+const float TENTACLE_LINK = 8.f;
+const int FABRIK_ITERATIONS = 4;
+
+// The arrow-key chain moves at a fixed rate, stepped at 60 Hz
+const float CHAIN_STEP = 1.f / 60.f;
+const float HEAD_SPEED = 240.f; // Pixels per second
+
+// Cloth demo: a sheet hanging from its top row
+const int CLOTH_COLUMNS = 60;
+const int CLOTH_ROWS = 40;
+const float CLOTH_SPACING = 10.f;
+const int CLOTH_ITERATIONS = 8;
+const float CLOTH_STEP = 1.f / 60.f;
 
 sf::Vector2f normalise_vector(float w, float h, float dist)
 {
@@ -25,19 +51,228 @@ void circle_constraint(sf::CircleShape &anchor, sf::CircleShape &target, float c
     target.setPosition(projection);
 }
 
-int main()
+// Headless comparison of the per-shape circle_constraint loop with the bulk
+// solver, both doing the same rope projection on the same chains
+int run_chain_benchmark(size_t chainCount, size_t segmentCount, int frames)
 {
+    auto elapsedMs = [](std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    std::vector<std::vector<sf::CircleShape>> shapes(chainCount, std::vector<sf::CircleShape>(segmentCount, sf::CircleShape(2.f)));
+    ChainSolver solver(chainCount, segmentCount, 5.f);
+    for (size_t chain = 0; chain < chainCount; chain++)
+    {
+        for (size_t segment = 0; segment < segmentCount; segment++)
+        {
+            sf::Vector2f position(chain % 100 * 3.f, segment * 0.5f);
+            shapes[chain][segment].setPosition(position);
+            solver.setPosition(chain, segment, position);
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        for (size_t chain = 0; chain < chainCount; chain++)
+        {
+            shapes[chain][0].move(std::cos(frame * 0.1f), std::sin(frame * 0.1f) + 1.f);
+            for (size_t i = 1; i < segmentCount; i++)
+            {
+                circle_constraint(shapes[chain][i-1], shapes[chain][i], 5.f);
+            }
+        }
+    }
+    double shapeMs = elapsedMs(start) / frames;
+
+    start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        for (size_t chain = 0; chain < chainCount; chain++)
+        {
+            solver.setPosition(chain, 0, solver.getPosition(chain, 0) + sf::Vector2f(std::cos(frame * 0.1f), std::sin(frame * 0.1f) + 1.f));
+        }
+        solver.solveFollow();
+    }
+    double solverMs = elapsedMs(start) / frames;
+
+    // Both rope paths ran the same projection, so they should agree
+    float maxError = 0.f;
+    for (size_t chain = 0; chain < chainCount; chain++)
+    {
+        for (size_t segment = 0; segment < segmentCount; segment++)
+        {
+            sf::Vector2f difference = solver.getPosition(chain, segment) - shapes[chain][segment].getPosition();
+            maxError = std::max(maxError, std::max(std::abs(difference.x), std::abs(difference.y)));
+        }
+    }
+
+    start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++)
+    {
+        solver.solveFabrik(FABRIK_ITERATIONS);
+    }
+    double fabrikMs = elapsedMs(start) / frames;
+
+    std::cout << "chains=" << chainCount << " segments=" << segmentCount
+              << " CircleShape=" << shapeMs << "ms solver=" << solverMs << "ms fabrik x" << FABRIK_ITERATIONS
+              << "=" << fabrikMs << "ms max difference=" << maxError << "px\n";
+    return 0;
+}
+
+// Headless cloth run: a size x size sheet (with shear links) stepped at
+// 60 Hz, on one thread and on the whole pool
+int run_cloth_benchmark(int size, int iterations, int frames)
+{
+    std::vector<float> finalX[2];
+    for (int pass = 0; pass < 2; pass++)
+    {
+        ThreadPool pool(pass == 0 ? 1 : 0);
+        Cloth cloth;
+        cloth.buildGrid(size, size, 2.f, sf::Vector2f(0, 0), true);
+        for (int column = 0; column < size; column++)
+        {
+            cloth.setPinned(column, true);
+        }
+        cloth.setIterations(iterations);
+
+        double constraintsPerSecond = 0.0;
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; frame++)
+        {
+            cloth.step(CLOTH_STEP, pool);
+            constraintsPerSecond += cloth.getConstraintsPerSecond();
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+
+        std::cout << "cloth=" << size << "x" << size << " constraints=" << cloth.getConstraintCount()
+                  << " colours=" << cloth.getColourCount() << " threads=" << pool.getThreadCount()
+                  << " step=" << ms << "ms constraints/s=" << constraintsPerSecond / frames << "\n";
+        finalX[pass].assign(cloth.getX(), cloth.getX() + cloth.getParticleCount());
+    }
+
+    // Colours never share particles, so thread count can't change the result
+    std::cout << "identical=" << (finalX[0] == finalX[1]) << "\n";
+    return 0;
+}
+
+// Hanging cloth; drag it around with the left mouse button
+int run_cloth_demo()
+{
+    sf::RenderWindow window(sf::VideoMode(800, 600), "Cloth");
+    ThreadPool pool;
+    Cloth cloth;
+    cloth.buildGrid(CLOTH_COLUMNS, CLOTH_ROWS, CLOTH_SPACING, sf::Vector2f(100, 50), false);
+    for (int column = 0; column < CLOTH_COLUMNS; column += 6)
+    {
+        cloth.setPinned(column, true);
+    }
+    cloth.setIterations(CLOTH_ITERATIONS);
+
+    sf::VertexArray links(sf::Lines, cloth.getConstraintCount() * 2);
+    long grabbed = -1;
+    GameLoop loop(CLOTH_STEP);
+
+    while (window.isOpen())
+    {
+        sf::Event event;
+        while (window.pollEvent(event))
+        {
+            if (event.type == sf::Event::Closed)
+                window.close();
+            if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left)
+            {
+                // Grab the nearest particle
+                sf::Vector2f mouse(event.mouseButton.x, event.mouseButton.y);
+                float best = 30.f * 30.f;
+                for (size_t i = 0; i < cloth.getParticleCount(); i++)
+                {
+                    sf::Vector2f offset = cloth.getPosition(i) - mouse;
+                    if (offset.x * offset.x + offset.y * offset.y < best)
+                    {
+                        best = offset.x * offset.x + offset.y * offset.y;
+                        grabbed = (long)i;
+                    }
+                }
+            }
+            if (event.type == sf::Event::MouseButtonReleased)
+                grabbed = -1;
+            if (event.type == sf::Event::MouseMoved && grabbed >= 0)
+                cloth.setPosition(grabbed, sf::Vector2f(event.mouseMove.x, event.mouseMove.y));
+        }
+
+        for (int steps = loop.advance(); steps > 0; --steps)
+        {
+            cloth.step(CLOTH_STEP, pool);
+        }
+
+        const float* x = cloth.getX();
+        const float* y = cloth.getY();
+        for (size_t i = 0; i < cloth.getConstraintCount(); i++)
+        {
+            uint32_t a = cloth.getConstraintA(i), b = cloth.getConstraintB(i);
+            links[i * 2] = sf::Vertex(sf::Vector2f(x[a], y[a]), sf::Color::White);
+            links[i * 2 + 1] = sf::Vertex(sf::Vector2f(x[b], y[b]), sf::Color::White);
+        }
+
+        window.clear();
+        window.draw(links);
+        window.display();
+        loop.pace();
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    // ./game --bench-chains [chains] [segments] [frames]
+    if (argc > 1 && std::string(argv[1]) == "--bench-chains")
+    {
+        return run_chain_benchmark(argc > 2 ? std::stoul(argv[2]) : 4000, argc > 3 ? std::stoul(argv[3]) : 200,
+                                   argc > 4 ? std::stoi(argv[4]) : 20);
+    }
+    // ./game --bench-cloth [size] [iterations] [frames]
+    if (argc > 1 && std::string(argv[1]) == "--bench-cloth")
+    {
+        return run_cloth_benchmark(argc > 2 ? std::stoi(argv[2]) : 256, argc > 3 ? std::stoi(argv[3]) : 8,
+                                   argc > 4 ? std::stoi(argv[4]) : 60);
+    }
+    if (argc > 1 && std::string(argv[1]) == "--cloth")
+    {
+        return run_cloth_demo();
+    }
+
     sf::RenderWindow window(sf::VideoMode(800, 600), "Circle Constraints");
 
+    // The original three-segment chain, now one chain of a rope solver
+    ChainSolver chain(1, 3, 100.f);
+    chain.resetChain(0, sf::Vector2f(150, 150));
     std::vector<sf::CircleShape> segments;
     for (size_t i = 0; i < 3; i++)
     {
         sf::CircleShape shape(50.f);
         shape.setFillColor( i == 0 ? sf::Color::Green : sf::Color::Red);
-        shape.setPosition(150,150);
         segments.push_back(shape);
     }
-    
+
+    // Tentacles rooted along the bottom edge, heads chasing the mouse
+    ChainSolver tentacles(TENTACLE_COUNT, TENTACLE_SEGMENTS, TENTACLE_LINK);
+    for (size_t i = 0; i < TENTACLE_COUNT; i++)
+    {
+        sf::Vector2f root((i + 0.5f) * 800.f / TENTACLE_COUNT, 600.f);
+        tentacles.resetChain(i, root);
+        for (size_t segment = 1; segment < TENTACLE_SEGMENTS; segment++)
+        {
+            // Thinner towards the tip: links shrink from root to head
+            tentacles.setLinkLength(i, segment, TENTACLE_LINK * (0.5f + segment / (float)TENTACLE_SEGMENTS));
+        }
+    }
+    sf::VertexArray tentacleLines(sf::Lines, TENTACLE_COUNT * (TENTACLE_SEGMENTS - 1) * 2);
+    BatchLayer segmentLayer;
+    sf::Vector2f mouse(400, 300);
+    GameLoop loop(CHAIN_STEP);
+
     while (window.isOpen())
     {
         sf::Event event;
@@ -45,37 +280,69 @@ int main()
         {
             if (event.type == sf::Event::Closed)
                 window.close();
+            if (event.type == sf::Event::MouseMoved)
+                mouse = sf::Vector2f(event.mouseMove.x, event.mouseMove.y);
         }
-        // UPDATE
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left))
-        {
-            segments[0].move(-0.1f, 0.f);
-        } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right))
+        // UPDATE: the head moves HEAD_SPEED pixels a second whatever the frame rate
+        for (int steps = loop.advance(); steps > 0; --steps)
         {
-            segments[0].move(0.1f, 0.f);
-        }
+            float distance = HEAD_SPEED * CHAIN_STEP;
+            sf::Vector2f head = chain.getPosition(0, 0);
+            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left))
+            {
+                head.x -= distance;
+            } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right))
+            {
+                head.x += distance;
+            }
 
-         if (sf::Keyboard::isKeyPressed(sf::Keyboard::Up))
-        {
-            segments[0].move(0.f, -0.1f);
-        } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Down))
-        {
-            segments[0].move(0.f, 0.1f);
+            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Up))
+            {
+                head.y -= distance;
+            } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Down))
+            {
+                head.y += distance;
+            }
+            chain.setPosition(0, 0, head);
+            chain.solveFollow();
+
+            for (size_t i = 0; i < TENTACLE_COUNT; i++)
+            {
+                tentacles.setTarget(i, mouse);
+            }
+            tentacles.solveFabrik(FABRIK_ITERATIONS);
         }
 
-        for (size_t i = 1; i < segments.size(); i++)
+        // DRAW: shapes and vertices are filled from the solvers, never the other way round
+        window.clear();
+
+        size_t vertex = 0;
+        for (size_t segment = 1; segment < TENTACLE_SEGMENTS; segment++)
         {
-            circle_constraint(segments[i-1], segments[i], 100.f);
+            const float* ax = tentacles.getX(segment - 1);
+            const float* ay = tentacles.getY(segment - 1);
+            const float* bx = tentacles.getX(segment);
+            const float* by = tentacles.getY(segment);
+            sf::Color color(60, 80 + 150 * segment / TENTACLE_SEGMENTS, 200);
+            for (size_t i = 0; i < TENTACLE_COUNT; i++)
+            {
+                tentacleLines[vertex++] = sf::Vertex(sf::Vector2f(ax[i], ay[i]), color);
+                tentacleLines[vertex++] = sf::Vertex(sf::Vector2f(bx[i], by[i]), color);
+            }
         }
+        window.draw(tentacleLines);
 
-        // DRAW
-        window.clear();
+        segmentLayer.clear();
         for (size_t i = 0; i < segments.size(); i++)
         {
-            window.draw(segments[(segments.size() -1)-i]);
+            size_t index = (segments.size() - 1) - i;
+            segments[index].setPosition(chain.getPosition(0, index));
+            segmentLayer.addShape(segments[index]);
         }
+        window.draw(segmentLayer);
         window.display();
+        loop.pace();
     }
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,130 @@
+#include "CollisionWorld.hpp"
+
+#include "../common/Box2DProfile.hpp"
+
+namespace {
+
+// Box index stored in shape user data (0 means not a box)
+void* boxUserData(size_t index) { return (void*)(intptr_t)(index + 1); }
+long boxIndexOf(b2ShapeId shapeId) { return (long)(intptr_t)b2Shape_GetUserData(shapeId) - 1; }
+
+b2WorldId createWorld(const WorldParams& params) {
+    b2WorldDef worldDef = b2DefaultWorldDef();
+    worldDef.gravity = (b2Vec2){0.0f, params.gravity};
+    return createWorldLocked(worldDef);
+}
+
+void createGround(b2WorldId worldId) {
+    b2BodyDef groundDef = b2DefaultBodyDef();
+    groundDef.position = (b2Vec2){400.0f / SCALE, 570.0f / SCALE};
+    b2BodyId groundId = b2CreateBody(worldId, &groundDef);
+
+    b2Polygon groundBox = b2MakeBox(400.0f / SCALE, 10.0f / SCALE);
+    b2ShapeDef groundShapeDef = b2DefaultShapeDef();
+    b2CreatePolygonShape(groundId, &groundShapeDef, &groundBox);
+}
+
+} // namespace
+
+CollisionWorld::CollisionWorld(const WorldParams& params) : params(params), worldId(createWorld(params)), boxes(SCALE) {
+    // Create player (green box)
+    b2BodyDef playerDef = b2DefaultBodyDef();
+    playerDef.type = b2_dynamicBody;
+    playerDef.position = (b2Vec2){400.0f / SCALE, 500.0f / SCALE};
+    playerDef.fixedRotation = true;
+    playerId = b2CreateBody(worldId, &playerDef);
+
+    b2Polygon playerBox = b2MakeBox(40.0f / SCALE, 40.0f / SCALE);
+    b2ShapeDef playerShapeDef = b2DefaultShapeDef();
+    playerShapeDef.density = 1.0f;
+    playerShapeDef.friction = 0.3f;
+    playerShapeId = b2CreatePolygonShape(playerId, &playerShapeDef, &playerBox);
+
+    // Sensor ring reporting boxes near the player
+    b2Circle nearbyCircle = {(b2Vec2){0.0f, 0.0f}, COLLISION_DISTANCE / SCALE};
+    b2ShapeDef sensorDef = b2DefaultShapeDef();
+    sensorDef.isSensor = true;
+    sensorShapeId = b2CreateCircleShape(playerId, &sensorDef, &nearbyCircle);
+
+    createGround(worldId);
+
+    // The registry follows Box2D's move events, so resting boxes cost nothing
+    boxArchetype = boxes.addArchetype(sf::Vector2f(60, 60), sf::Color::Blue);
+    for (int i = 0; i < 5; i++) {
+        spawnBox(200 + i * 100, 100);
+    }
+
+    // Boxes touching the player turn yellow, boxes inside the sensor ring
+    // are counted as nearby
+    tracker.setOnBegin([this](b2ShapeId a, b2ShapeId b, ContactTracker::PairKind kind) {
+        if (kind == ContactTracker::PairKind::Sensor) {
+            nearbyCount += B2_ID_EQUALS(a, sensorShapeId) && boxIndexOf(b) >= 0;
+            return;
+        }
+        b2ShapeId other = B2_ID_EQUALS(a, playerShapeId) ? b : B2_ID_EQUALS(b, playerShapeId) ? a : b2_nullShapeId;
+        if (B2_IS_NULL(other) || boxIndexOf(other) < 0)
+            return;
+        collisionCount += 1;
+        boxes.setColor((uint32_t)boxIndexOf(other), sf::Color::Yellow);
+    });
+    tracker.setOnEnd([this](b2ShapeId a, b2ShapeId b, ContactTracker::PairKind kind) {
+        if (kind == ContactTracker::PairKind::Sensor) {
+            nearbyCount -= B2_ID_EQUALS(a, sensorShapeId) && boxIndexOf(b) >= 0;
+            return;
+        }
+        b2ShapeId other = B2_ID_EQUALS(a, playerShapeId) ? b : B2_ID_EQUALS(b, playerShapeId) ? a : b2_nullShapeId;
+        if (B2_IS_NULL(other) || boxIndexOf(other) < 0)
+            return;
+        boxes.setColor((uint32_t)boxIndexOf(other), sf::Color::Blue);
+    });
+}
+
+CollisionWorld::~CollisionWorld() {
+    destroyWorldLocked(worldId);
+}
+
+void CollisionWorld::spawnBox(float x, float y) {
+    b2BodyDef boxDef = b2DefaultBodyDef();
+    boxDef.type = b2_dynamicBody;
+    boxDef.position = (b2Vec2){x / SCALE, y / SCALE};
+    boxDef.linearDamping = params.linearDamping;
+    b2BodyId boxId = b2CreateBody(worldId, &boxDef);
+
+    b2Polygon boxShape = b2MakeBox(30.0f / SCALE, 30.0f / SCALE);
+    b2ShapeDef shapeDef = b2DefaultShapeDef();
+    shapeDef.density = 1.0f;
+    shapeDef.friction = params.friction;
+    shapeDef.userData = boxUserData(boxes.size());
+    b2CreatePolygonShape(boxId, &shapeDef, &boxShape);
+
+    boxes.create(boxId, boxArchetype);
+}
+
+void CollisionWorld::step() {
+    b2Vec2 velocity = b2Body_GetLinearVelocity(playerId);
+    velocity.x = playerDirection * PLAYER_SPEED;
+    b2Body_SetLinearVelocity(playerId, velocity);
+
+    {
+        PROFILE_SCOPE(profiler, "b2World_Step");
+        b2World_Step(worldId, COLLISION_TIME_STEP, params.subStepCount);
+    }
+    ++stepCount;
+    if (profiler)
+        recordBox2DProfile(*profiler, worldId);
+
+    // Only pairs that began or ended this step cost anything
+    {
+        PROFILE_SCOPE(profiler, "contact tracker");
+        tracker.update(worldId);
+    }
+
+    // Likewise only boxes that moved
+    PROFILE_SCOPE(profiler, "transform sync");
+    boxes.update(worldId);
+}
+
+sf::Vector2f CollisionWorld::getPlayerPosition() const {
+    b2Vec2 position = b2Body_GetPosition(playerId);
+    return sf::Vector2f(position.x * SCALE, position.y * SCALE);
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <box2d/box2d.h>
+#include <cstddef>
+#include <cstdint>
+#include "ContactTracker.hpp"
+#include "../common/BodyRegistry.hpp"
+#include "../common/Profiler.hpp"
+#include "../common/WorldSweep.hpp"
+
+const float SCALE = 30.0f;
+const float PLAYER_SPEED = 1.0f;
+const float COLLISION_DISTANCE = 60.0f; // Radius of the player's "nearby" sensor
+const float COLLISION_TIME_STEP = 1.0f / 60.0f;
+
+// The demo's own tuning: reduced gravity, undamped boxes with Box2D's
+// default friction
+const WorldParams COLLISION_PARAMS = {3.0f, 0.0f, 0.6f, 4};
+
+// The collision-detection world without a window: ground, the player with
+// its "nearby" sensor and the falling boxes, stepped at a fixed 60 Hz.
+// Boxes touching the player turn yellow and are counted; boxes inside the
+// sensor ring are counted as nearby, all from Box2D's events.
+class CollisionWorld {
+public:
+    explicit CollisionWorld(const WorldParams& params = COLLISION_PARAMS);
+    ~CollisionWorld();
+
+    CollisionWorld(const CollisionWorld&) = delete;
+    CollisionWorld& operator=(const CollisionWorld&) = delete;
+
+    // -1 walks left, 1 right, 0 stands still
+    void setPlayerDirection(int direction) { playerDirection = direction; }
+
+    // Position in pixels
+    void spawnBox(float x, float y);
+
+    // One fixed step, then this step's contact events and moved boxes
+    void step();
+
+    // Time the step's phases with `value`; null stops it
+    void setProfiler(Profiler* value) { profiler = value; }
+
+    // Pixels
+    sf::Vector2f getPlayerPosition() const;
+
+    b2WorldId getWorldId() const { return worldId; }
+    const BodyRegistry& getBoxes() const { return boxes; }
+    const ContactTracker& getTracker() const { return tracker; }
+    // Boxes that started touching the player
+    unsigned getCollisionCount() const { return collisionCount; }
+    size_t getNearbyCount() const { return nearbyCount; }
+    long getStepCount() const { return stepCount; }
+
+private:
+    WorldParams params;
+    b2WorldId worldId;
+    b2BodyId playerId;
+    b2ShapeId playerShapeId;
+    b2ShapeId sensorShapeId;
+    BodyRegistry boxes;
+    uint16_t boxArchetype;
+    ContactTracker tracker;
+    Profiler* profiler = nullptr;
+    int playerDirection = 0;
+    unsigned collisionCount = 0;
+    size_t nearbyCount = 0;
+    long stepCount = 0;
+};
@@ -0,0 +1,71 @@
+#include "ContactTracker.hpp"
+
+#include <algorithm>
+
+uint64_t ContactTracker::makeKey(b2ShapeId a, b2ShapeId b, PairKind kind) {
+    // Shape indices are below 2^31, so the top bit is free for the kind.
+    // Contacts are unordered; sensor pairs keep sensor first.
+    uint32_t first = (uint32_t)a.index1, second = (uint32_t)b.index1;
+    if (kind == PairKind::Contact && first > second)
+        std::swap(first, second);
+    uint64_t key = ((uint64_t)first << 32) | second;
+    return kind == PairKind::Sensor ? key | (1ull << 63) : key;
+}
+
+void ContactTracker::update(b2WorldId worldId) {
+    b2ContactEvents contacts = b2World_GetContactEvents(worldId);
+    for (int i = 0; i < contacts.beginCount; ++i) {
+        begin(contacts.beginEvents[i].shapeIdA, contacts.beginEvents[i].shapeIdB, PairKind::Contact);
+    }
+    for (int i = 0; i < contacts.endCount; ++i) {
+        end(contacts.endEvents[i].shapeIdA, contacts.endEvents[i].shapeIdB, PairKind::Contact);
+    }
+
+    b2SensorEvents sensors = b2World_GetSensorEvents(worldId);
+    for (int i = 0; i < sensors.beginCount; ++i) {
+        begin(sensors.beginEvents[i].sensorShapeId, sensors.beginEvents[i].visitorShapeId, PairKind::Sensor);
+    }
+    for (int i = 0; i < sensors.endCount; ++i) {
+        end(sensors.endEvents[i].sensorShapeId, sensors.endEvents[i].visitorShapeId, PairKind::Sensor);
+    }
+}
+
+void ContactTracker::begin(b2ShapeId a, b2ShapeId b, PairKind kind) {
+    bool inserted = pairs.emplace(makeKey(a, b, kind), Pair{a, b, kind}).second;
+    if (!inserted)
+        return;
+
+    ++beginCount;
+    if (kind == PairKind::Contact)
+        ++contactCount;
+    if (onBegin)
+        onBegin(a, b, kind);
+}
+
+void ContactTracker::end(b2ShapeId a, b2ShapeId b, PairKind kind) {
+    auto it = pairs.find(makeKey(a, b, kind));
+    if (it == pairs.end())
+        return; // Already dropped by removeShape
+
+    Pair pair = it->second;
+    pairs.erase(it);
+    if (kind == PairKind::Contact)
+        --contactCount;
+    if (onEnd)
+        onEnd(pair.a, pair.b, kind);
+}
+
+void ContactTracker::removeShape(b2ShapeId shapeId) {
+    std::vector<Pair> removed;
+    for (const auto& entry : pairs) {
+        if (entry.second.a.index1 == shapeId.index1 || entry.second.b.index1 == shapeId.index1)
+            removed.push_back(entry.second);
+    }
+    for (const Pair& pair : removed) {
+        end(pair.a, pair.b, pair.kind);
+    }
+}
+
+bool ContactTracker::isTouching(b2ShapeId a, b2ShapeId b, PairKind kind) const {
+    return pairs.count(makeKey(a, b, kind)) != 0;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <box2d/box2d.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+// Set of shape pairs that are currently touching, kept up to date from
+// Box2D's begin/end contact and sensor events instead of testing bodies
+// against each other. update() costs O(events) per step, not O(bodies).
+//
+// Contact events need enableContactEvents on at least one of the two shapes,
+// sensor events need a sensor shape and enableSensorEvents on the visitor
+// (both default to on).
+class ContactTracker {
+public:
+    enum class PairKind { Contact, Sensor };
+
+    // For sensor pairs `a` is the sensor and `b` the visitor
+    typedef std::function<void(b2ShapeId a, b2ShapeId b, PairKind kind)> PairCallback;
+
+    void setOnBegin(PairCallback callback) { onBegin = callback; }
+    void setOnEnd(PairCallback callback) { onEnd = callback; }
+
+    // Drain this step's events; call once after every b2World_Step
+    void update(b2WorldId worldId);
+
+    // Forget (and report the end of) every pair of a shape about to be
+    // destroyed, so a later shape reusing its id starts clean
+    void removeShape(b2ShapeId shapeId);
+    void clear() { pairs.clear(); }
+
+    bool isTouching(b2ShapeId a, b2ShapeId b, PairKind kind = PairKind::Contact) const;
+    size_t getActiveCount() const { return pairs.size(); }
+    size_t getActiveCount(PairKind kind) const { return kind == PairKind::Contact ? contactCount : pairs.size() - contactCount; }
+
+    // Begin events seen since construction
+    size_t getBeginCount() const { return beginCount; }
+
+    // Visit every active pair
+    template <typename Fn>
+    void forEachPair(Fn fn) const {
+        for (const auto& entry : pairs) {
+            fn(entry.second.a, entry.second.b, entry.second.kind);
+        }
+    }
+
+private:
+    struct Pair {
+        b2ShapeId a;
+        b2ShapeId b;
+        PairKind kind;
+    };
+
+    static uint64_t makeKey(b2ShapeId a, b2ShapeId b, PairKind kind);
+    void begin(b2ShapeId a, b2ShapeId b, PairKind kind);
+    void end(b2ShapeId a, b2ShapeId b, PairKind kind);
+
+    std::unordered_map<uint64_t, Pair> pairs;
+    size_t contactCount = 0;
+    size_t beginCount = 0;
+    PairCallback onBegin;
+    PairCallback onEnd;
+};
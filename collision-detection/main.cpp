@@ -1,141 +1,327 @@
 #include <SFML/Graphics.hpp>
 #include <box2d/box2d.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
+#include <random>
+#include <string>
 #include <vector>
 #include <cmath>
+#include "CollisionWorld.hpp"
+#include "ContactTracker.hpp"
+#include "../common/BatchLayer.hpp"
+#include "../common/BroadPhase.hpp"
+#include "../common/GameLoop.hpp"
+#include "../common/Profiler.hpp"
+#include "../common/ResourceCache.hpp"
+#include "../common/WorldSweep.hpp"
 
-const float SCALE = 30.0f;
-const float PLAYER_SPEED = 1.0f;
-const float COLLISION_DISTANCE = 60.0f; // Distance to check for collisions
+// Headless check: drop `boxCount` boxes onto a wide floor and compare the
+// tracker's active contact set with the touching contacts Box2D reports
+int runContactBenchmark(int boxCount, int frames) {
+    b2WorldDef worldDef = b2DefaultWorldDef();
+    worldDef.gravity = (b2Vec2){0.0f, 10.0f};
+    b2WorldId worldId = b2CreateWorld(&worldDef);
 
-struct Box {
-    b2BodyId bodyId;
-    sf::RectangleShape shape;
-};
+    int columns = 200;
+    float floorWidth = columns * 1.2f;
+    b2BodyDef groundDef = b2DefaultBodyDef();
+    groundDef.position = (b2Vec2){floorWidth / 2, 0.0f};
+    b2BodyId groundId = b2CreateBody(worldId, &groundDef);
+    b2Polygon groundBox = b2MakeBox(floorWidth / 2, 0.5f);
+    b2ShapeDef groundShapeDef = b2DefaultShapeDef();
+    b2CreatePolygonShape(groundId, &groundShapeDef, &groundBox);
 
-int main() {
-    sf::RenderWindow window(sf::VideoMode(800, 600), "SFML & Box2C Collision");
+    std::vector<b2BodyId> bodies;
+    for (int i = 0; i < boxCount; i++) {
+        b2BodyDef boxDef = b2DefaultBodyDef();
+        boxDef.type = b2_dynamicBody;
+        boxDef.position = (b2Vec2){(i % columns) * 1.2f + 0.6f, -1.0f - (i / columns) * 1.2f};
+        b2BodyId boxId = b2CreateBody(worldId, &boxDef);
+        b2Polygon boxShape = b2MakeBox(0.5f, 0.5f);
+        b2ShapeDef shapeDef = b2DefaultShapeDef();
+        shapeDef.density = 1.0f;
+        b2CreatePolygonShape(boxId, &shapeDef, &boxShape);
+        bodies.push_back(boxId);
+    }
+
+    ContactTracker tracker;
+    double stepMs = 0.0, trackMs = 0.0;
+    for (int frame = 0; frame < frames; frame++) {
+        auto start = std::chrono::steady_clock::now();
+        b2World_Step(worldId, 1.0f / 60.0f, 4);
+        auto stepped = std::chrono::steady_clock::now();
+        tracker.update(worldId);
+        stepMs += std::chrono::duration<double, std::milli>(stepped - start).count();
+        trackMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - stepped).count();
+    }
+
+    // Every touching contact shows up once per body it joins
+    bodies.push_back(groundId);
+    size_t touching = 0;
+    std::vector<b2ContactData> contactData;
+    for (b2BodyId bodyId : bodies) {
+        contactData.resize(b2Body_GetContactCapacity(bodyId));
+        int count = b2Body_GetContactData(bodyId, contactData.data(), (int)contactData.size());
+        for (int i = 0; i < count; i++) {
+            touching += contactData[i].manifold.pointCount > 0;
+        }
+    }
+    touching /= 2;
+
+    std::cout << "boxes=" << boxCount << " frames=" << frames << " step=" << stepMs / frames << "ms tracker="
+              << trackMs / frames << "ms active=" << tracker.getActiveCount(ContactTracker::PairKind::Contact)
+              << " box2d touching=" << touching << " begins=" << tracker.getBeginCount() << "\n";
+
+    b2DestroyWorld(worldId);
+    return tracker.getActiveCount(ContactTracker::PairKind::Contact) == touching ? 0 : 1;
+}
+
+// Headless broad-phase run: `rectCount` drifting rectangles, overlapping
+// pairs per frame from the grid and sweep-and-prune, against the brute-force
+// sf::FloatRect::intersects loop they replace (timed on one frame only)
+int runBroadPhaseBenchmark(int rectCount, int frames) {
+    float worldSize = std::sqrt((float)rectCount) * 40.0f;
+    srand(1);
+    std::vector<sf::FloatRect> rects;
+    for (int i = 0; i < rectCount; i++) {
+        rects.push_back(sf::FloatRect(rand() % (int)worldSize, rand() % (int)worldSize, 5 + rand() % 30, 5 + rand() % 30));
+    }
+
+    auto elapsedMs = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    size_t bruteCount = 0;
+    for (size_t i = 0; i < rects.size(); i++) {
+        for (size_t j = i + 1; j < rects.size(); j++) {
+            bruteCount += rects[i].intersects(rects[j]);
+        }
+    }
+    std::cout << "rects=" << rectCount << " brute force=" << elapsedMs(start) << "ms pairs=" << bruteCount << "\n";
+
+    const BroadPhaseMethod methods[] = {BroadPhaseMethod::UniformGrid, BroadPhaseMethod::SweepAndPrune};
+    for (BroadPhaseMethod method : methods) {
+        BroadPhase broadPhase(method, 64.0f); // About twice the largest rectangle
+        std::vector<uint32_t> proxies;
+        std::vector<sf::FloatRect> moving = rects;
+        for (const sf::FloatRect& rect : moving) {
+            proxies.push_back(broadPhase.insert(rect));
+        }
+
+        std::vector<BroadPhase::Pair> pairs;
+        broadPhase.findPairs(pairs);
+        size_t firstCount = pairs.size();
+
+        double total = 0.0;
+        for (int frame = 0; frame < frames; frame++) {
+            for (size_t i = 0; i < moving.size(); i++) {
+                moving[i].left += (rand() % 5 - 2) * 0.5f;
+                moving[i].top += (rand() % 5 - 2) * 0.5f;
+                broadPhase.move(proxies[i], moving[i]);
+            }
+            start = std::chrono::steady_clock::now();
+            broadPhase.findPairs(pairs);
+            total += elapsedMs(start);
+        }
+        std::cout << (method == BroadPhaseMethod::UniformGrid ? "grid" : "sweep and prune") << "=" << total / frames
+                  << "ms pairs=" << pairs.size() << " first frame matches brute force=" << (firstCount == bruteCount) << "\n";
+    }
+
+    // Id reuse: on a small subset, remove every third box and re-insert every
+    // sixth before the next query, so freed ids come straight back, then
+    // compare each method's pairs with brute force over the live boxes
+    bool reuseMatches = true;
+    size_t subset = std::min<size_t>(rects.size(), 1000);
+    for (BroadPhaseMethod method : methods) {
+        BroadPhase broadPhase(method, 64.0f);
+        std::vector<uint32_t> proxies;
+        std::vector<uint8_t> live(subset, 1);
+        for (size_t i = 0; i < subset; i++) {
+            proxies.push_back(broadPhase.insert(rects[i]));
+        }
+        std::vector<BroadPhase::Pair> pairs;
+        broadPhase.findPairs(pairs);
+        for (size_t i = 0; i < subset; i += 3) {
+            broadPhase.remove(proxies[i]);
+            live[i] = 0;
+        }
+        for (size_t i = 0; i < subset; i += 6) {
+            proxies[i] = broadPhase.insert(rects[i]);
+            live[i] = 1;
+        }
+        broadPhase.findPairs(pairs);
 
-    // Load font
-    sf::Font font;
-    if (!font.loadFromFile("/System/Library/Fonts/Supplemental/Arial.ttf")) {
-        std::cerr << "Could not load font!\n";
-        return -1;
+        std::vector<BroadPhase::Pair> expected;
+        for (size_t i = 0; i < subset; i++) {
+            for (size_t j = i + 1; j < subset; j++) {
+                if (live[i] && live[j] && rects[i].intersects(rects[j])) {
+                    uint32_t a = proxies[i], b = proxies[j];
+                    expected.push_back(a < b ? BroadPhase::Pair(a, b) : BroadPhase::Pair(b, a));
+                }
+            }
+        }
+        std::sort(pairs.begin(), pairs.end());
+        std::sort(expected.begin(), expected.end());
+        bool matches = pairs == expected;
+        reuseMatches = reuseMatches && matches;
+        std::cout << (method == BroadPhaseMethod::UniformGrid ? "grid" : "sweep and prune")
+                  << " after remove/re-insert: pairs=" << pairs.size() << " matches brute force=" << matches << "\n";
     }
+    return reuseMatches ? 0 : 1;
+}
+
+// Parameter sweep: one CollisionWorld per configuration, a box dropped at a
+// seeded spot every half second and the player standing still, for `steps`
+// steps each. Reports the boxes, player hits, nearby boxes, active contacts
+// and the worst step.
+int runSweep(const SweepOptions& options) {
+    std::vector<std::string> metrics = {"boxes", "collisions", "nearby", "contacts", "max_step_ms"};
+    return runWorldSweep(options, metrics, [](const WorldParams& params, long steps, SweepResult& result) {
+        CollisionWorld world(params);
+        std::mt19937 random(1);
+        double maxStepMs = 0.0;
+        for (long step = 0; step < steps; step++) {
+            if (step % 30 == 0)
+                world.spawnBox(100.0f + (float)(random() % 600), 0.0f);
+
+            auto start = std::chrono::steady_clock::now();
+            world.step();
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            result.seconds += ms / 1000.0;
+            maxStepMs = std::max(maxStepMs, ms);
+        }
+        result.steps = steps;
+        result.metrics = {(double)world.getBoxes().size(), (double)world.getCollisionCount(), (double)world.getNearbyCount(),
+                          (double)world.getTracker().getActiveCount(ContactTracker::PairKind::Contact), maxStepMs};
+    });
+}
+
+int main(int argc, char** argv) {
+    // ./game --bench-broadphase [rects] [frames]
+    if (argc > 1 && std::string(argv[1]) == "--bench-broadphase") {
+        return runBroadPhaseBenchmark(argc > 2 ? std::stoi(argv[2]) : 50000, argc > 3 ? std::stoi(argv[3]) : 60);
+    }
+    // ./game --bench-contacts [boxes] [frames]
+    if (argc > 1 && std::string(argv[1]) == "--bench-contacts") {
+        return runContactBenchmark(argc > 2 ? std::stoi(argv[2]) : 10000, argc > 3 ? std::stoi(argv[3]) : 300);
+    }
+    // ./game --sweep [steps] [threads] [csvPath] [gravity=1,3 damping=0,2 friction=0.3 substeps=4 ...]
+    if (argc > 1 && std::string(argv[1]) == "--sweep") {
+        SweepOptions options;
+        return parseSweepOptions(argc, argv, 2, options) ? runSweep(options) : 1;
+    }
+
+    sf::RenderWindow window(sf::VideoMode(800, 600), "SFML & Box2C Collision");
+
+    // The UI font loads in the background; text uses the built-in one until then
+    ResourceCache resources;
+    FontHandle font = resources.requestFont(defaultFontPaths());
 
     // Create text
-    sf::Text text("Click to spawn a box!", font, 20);
+    sf::Text text("Click to spawn a box!", resources.getFont(font), 20);
     text.setFillColor(sf::Color::White);
     text.setPosition(10, 10);
-    unsigned int collision_count = 0;
 
-    // Create Box2C world
-    b2WorldDef worldDef = b2DefaultWorldDef();
-    worldDef.gravity = (b2Vec2){0.0f, 3.0f};
-    b2WorldId worldId = b2CreateWorld(&worldDef);
-
-    // Create player (green box)
-    b2BodyDef playerDef = b2DefaultBodyDef();
-    playerDef.type = b2_dynamicBody;
-    playerDef.position = (b2Vec2){400.0f / SCALE, 500.0f / SCALE};
-    playerDef.fixedRotation = true;
-    b2BodyId playerId = b2CreateBody(worldId, &playerDef);
-
-    b2Polygon playerBox = b2MakeBox(40.0f / SCALE, 40.0f / SCALE);
-    b2ShapeDef playerShapeDef = b2DefaultShapeDef();
-    playerShapeDef.density = 1.0f;
-    playerShapeDef.friction = 0.3f;
-    b2CreatePolygonShape(playerId, &playerShapeDef, &playerBox);
+    // Player, ground and boxes; the window only draws them and feeds in the
+    // keys and clicks
+    CollisionWorld world;
 
     sf::RectangleShape playerRect(sf::Vector2f(80, 80));
     playerRect.setFillColor(sf::Color::Green);
     playerRect.setOrigin(40, 40);
 
-    // Create ground
-    b2BodyDef groundDef = b2DefaultBodyDef();
-    groundDef.position = (b2Vec2){400.0f / SCALE, 570.0f / SCALE};
-    b2BodyId groundId = b2CreateBody(worldId, &groundDef);
-
-    b2Polygon groundBox = b2MakeBox(400.0f / SCALE, 10.0f / SCALE);
-    b2ShapeDef groundShapeDef = b2DefaultShapeDef();
-    b2CreatePolygonShape(groundId, &groundShapeDef, &groundBox);
-
     sf::RectangleShape groundRect(sf::Vector2f(800, 20));
     groundRect.setFillColor(sf::Color::Red);
     groundRect.setOrigin(400, 10);
     groundRect.setPosition(400, 570);
 
-    // Create falling boxes
-    std::vector<Box> boxes;
-    for (int i = 0; i < 5; i++) {
-        b2BodyDef boxDef = b2DefaultBodyDef();
-        boxDef.type = b2_dynamicBody;
-        boxDef.position = (b2Vec2){(200 + i * 100) / SCALE, 100.0f / SCALE};
-        b2BodyId boxId = b2CreateBody(worldId, &boxDef);
+    // The ground is uploaded once; player and boxes are one draw per frame
+    BatchLayer staticLayer(BatchLayer::Static);
+    staticLayer.addShape(groundRect);
+    BatchLayer bodyLayer;
 
-        b2Polygon boxShape = b2MakeBox(30.0f / SCALE, 30.0f / SCALE);
-        b2ShapeDef shapeDef = b2DefaultShapeDef();
-        shapeDef.density = 1.0f;
-        b2CreatePolygonShape(boxId, &shapeDef, &boxShape);
-
-        sf::RectangleShape shape(sf::Vector2f(60, 60));
-        shape.setFillColor(sf::Color::Blue);
-        shape.setOrigin(30, 30);
-        shape.setPosition((200 + i * 100), 100);
+    // P shows the profiler under the HUD, T records a Chrome trace, C a CSV
+    Profiler profiler;
+    bool showProfile = false;
+    world.setProfiler(&profiler);
 
-        boxes.push_back({boxId, shape});
-    }
-
-    sf::Clock clock;
+    GameLoop loop(COLLISION_TIME_STEP);
     while (window.isOpen()) {
+        profiler.beginFrame();
         sf::Event event;
         while (window.pollEvent(event)) {
             if (event.type == sf::Event::Closed)
                 window.close();
+            if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left)
+                world.spawnBox(event.mouseButton.x, event.mouseButton.y);
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::P)
+                showProfile = !showProfile;
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::T) {
+                if (profiler.isTracing())
+                    profiler.stopTrace();
+                else
+                    profiler.startTrace("trace.json");
+            }
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::C) {
+                if (profiler.isWritingCsv())
+                    profiler.stopCsv();
+                else
+                    profiler.startCsv("profile.csv");
+            }
         }
+        profiler.setEnabled(showProfile || profiler.isTracing() || profiler.isWritingCsv());
 
         // Move player
-        b2Vec2 velocity = b2Body_GetLinearVelocity(playerId);
         if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left)) {
-            velocity.x = -PLAYER_SPEED;
+            world.setPlayerDirection(-1);
         } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right)) {
-            velocity.x = PLAYER_SPEED;
+            world.setPlayerDirection(1);
         } else {
-            velocity.x = 0;
+            world.setPlayerDirection(0);
         }
-        b2Body_SetLinearVelocity(playerId, velocity);
 
-        // Step the world
-        float timeStep = 1.0f / 60.0f;
-        b2World_Step(worldId, timeStep, 4);
+        // Step the world at a fixed 60 Hz whatever the frame rate
+        for (int steps = loop.advance(); steps > 0; --steps) {
+            world.step();
+        }
 
         // Update player position
-        b2Vec2 playerPos = b2Body_GetPosition(playerId);
-        playerRect.setPosition(playerPos.x * SCALE, playerPos.y * SCALE);
+        playerRect.setPosition(world.getPlayerPosition());
 
-        // Check for collisions manually
-        for (auto& box : boxes) {
-            playerRect.getGlobalBounds().intersects(box.shape.getGlobalBounds());
-            collision_count += 1;
-        }
+        std::string hud = "Collision Count: " + std::to_string(world.getCollisionCount()) +
+                          "\nNearby: " + std::to_string(world.getNearbyCount()) + "\nActive contacts: " +
+                          std::to_string(world.getTracker().getActiveCount(ContactTracker::PairKind::Contact));
+        if (showProfile)
+            hud += "\n" + profiler.formatOverlay();
+        text.setString(hud);
 
-        text.setString("Collision Count: " + std::to_string(collision_count));
+        resources.update();
+        text.setFont(resources.getFont(font));
 
         // Render
-        window.clear();
-        window.draw(groundRect);
-        window.draw(playerRect);
-
-        // Draw falling boxes
-        for (auto& box : boxes) {
-            b2Vec2 pos = b2Body_GetPosition(box.bodyId);
-            box.shape.setPosition(pos.x * SCALE, pos.y * SCALE);
-            window.draw(box.shape);
+        {
+            PROFILE_SCOPE(profiler, "draw");
+            window.clear();
+            window.draw(staticLayer);
+
+            // Player, then the falling boxes
+            bodyLayer.clear();
+            bodyLayer.addShape(playerRect);
+            world.getBoxes().appendTo(bodyLayer, loop.getAlpha());
+            window.draw(bodyLayer);
+            window.draw(text);
         }
-        window.draw(text);
-        window.display();
+        {
+            PROFILE_SCOPE(profiler, "display");
+            window.display();
+        }
+        profiler.endFrame();
+        loop.pace();
     }
 
-    b2DestroyWorld(worldId);
     return 0;
 }
@@ -0,0 +1,99 @@
+#include "BatchLayer.hpp"
+
+#include <cmath>
+
+BatchLayer::BatchLayer(Usage usage) : usage(usage), buffer(sf::Triangles, sf::VertexBuffer::Static) {}
+
+void BatchLayer::clear() {
+    vertices.clear();
+    uploaded = false;
+}
+
+void BatchLayer::pushQuad(sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Vector2f d, sf::Color color) {
+    // Two triangles, a-b-c and a-c-d
+    vertices.emplace_back(a, color);
+    vertices.emplace_back(b, color);
+    vertices.emplace_back(c, color);
+    vertices.emplace_back(a, color);
+    vertices.emplace_back(c, color);
+    vertices.emplace_back(d, color);
+    uploaded = false;
+}
+
+void BatchLayer::addRect(sf::Vector2f position, sf::Vector2f size, sf::Color color) {
+    sf::Vector2f end = position + size;
+    pushQuad(position, sf::Vector2f(end.x, position.y), end, sf::Vector2f(position.x, end.y), color);
+}
+
+void BatchLayer::addQuad(sf::Vector2f center, sf::Vector2f size, float angle, sf::Color color) {
+    float radians = angle * 3.14159265f / 180.f;
+    float c = std::cos(radians), s = std::sin(radians);
+
+    // Half extents along the rotated x and y axes
+    sf::Vector2f x(c * size.x / 2, s * size.x / 2);
+    sf::Vector2f y(-s * size.y / 2, c * size.y / 2);
+    pushQuad(center - x - y, center + x - y, center + x + y, center - x + y, color);
+}
+
+const std::vector<sf::Vector2f>& BatchLayer::unitCircle(size_t pointCount) {
+    if (circlePoints.size() != pointCount) {
+        // Same points as sf::CircleShape, starting at the top
+        circlePoints.resize(pointCount);
+        for (size_t i = 0; i < pointCount; i++) {
+            float angle = i * 2 * 3.14159265f / pointCount - 3.14159265f / 2;
+            circlePoints[i] = sf::Vector2f(std::cos(angle), std::sin(angle));
+        }
+    }
+    return circlePoints;
+}
+
+void BatchLayer::addCircle(sf::Vector2f center, float radius, sf::Color color, size_t pointCount) {
+    const std::vector<sf::Vector2f>& points = unitCircle(pointCount);
+    for (size_t i = 0; i < pointCount; i++) {
+        const sf::Vector2f& next = points[(i + 1) % pointCount];
+        vertices.emplace_back(center, color);
+        vertices.emplace_back(center + points[i] * radius, color);
+        vertices.emplace_back(center + next * radius, color);
+    }
+    uploaded = false;
+}
+
+void BatchLayer::addShape(const sf::RectangleShape& shape) {
+    const sf::Transform& transform = shape.getTransform();
+    sf::Vector2f size = shape.getSize();
+    pushQuad(transform.transformPoint(0, 0), transform.transformPoint(size.x, 0), transform.transformPoint(size.x, size.y),
+             transform.transformPoint(0, size.y), shape.getFillColor());
+}
+
+void BatchLayer::addShape(const sf::CircleShape& shape) {
+    // Local coordinates put the circle's bounding box at the origin
+    const sf::Transform& transform = shape.getTransform();
+    float radius = shape.getRadius();
+    sf::Color color = shape.getFillColor();
+    sf::Vector2f center = transform.transformPoint(radius, radius);
+    const std::vector<sf::Vector2f>& points = unitCircle(shape.getPointCount());
+    for (size_t i = 0; i < points.size(); i++) {
+        const sf::Vector2f& next = points[(i + 1) % points.size()];
+        vertices.emplace_back(center, color);
+        vertices.emplace_back(transform.transformPoint(radius + points[i].x * radius, radius + points[i].y * radius), color);
+        vertices.emplace_back(transform.transformPoint(radius + next.x * radius, radius + next.y * radius), color);
+    }
+    uploaded = false;
+}
+
+void BatchLayer::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    if (vertices.empty())
+        return;
+
+    if (usage == Static && sf::VertexBuffer::isAvailable()) {
+        if (!uploaded) {
+            uploaded = buffer.getVertexCount() == vertices.size() || buffer.create(vertices.size());
+            uploaded = uploaded && buffer.update(vertices.data());
+        }
+        if (uploaded) {
+            target.draw(buffer, states);
+            return;
+        }
+    }
+    target.draw(vertices.data(), vertices.size(), sf::Triangles, states);
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+
+// One draw call's worth of coloured triangles. Rectangles (optionally
+// rotated) and tessellated circles are packed into a single vertex list and
+// drawn together, instead of one window.draw per sf::Shape, so the number
+// of draw calls stays at one per layer however many objects it holds.
+//
+// A Dynamic layer is cleared and refilled every frame and drawn straight
+// from memory. A Static layer (ground, obstacles, terrain) is uploaded to an
+// sf::VertexBuffer on the first draw after it changed and redrawn from the
+// GPU until it changes again; without VBO support it draws like a Dynamic
+// one.
+class BatchLayer : public sf::Drawable {
+public:
+    enum Usage { Dynamic, Static };
+
+    explicit BatchLayer(Usage usage = Dynamic);
+
+    void clear();
+    void reserveQuads(size_t count) { vertices.reserve(count * 6); }
+
+    // Axis-aligned, from the top-left corner
+    void addRect(sf::Vector2f position, sf::Vector2f size, sf::Color color);
+    // Centred and rotated by `angle` degrees, like a shape with its origin in the middle
+    void addQuad(sf::Vector2f center, sf::Vector2f size, float angle, sf::Color color);
+    // A fan of `pointCount` triangles (sf::CircleShape's default is 30)
+    void addCircle(sf::Vector2f center, float radius, sf::Color color, size_t pointCount = 30);
+
+    // An existing shape's fill, through its full transform (origin,
+    // position, rotation, scale); outlines and textures are ignored
+    void addShape(const sf::RectangleShape& shape);
+    void addShape(const sf::CircleShape& shape);
+
+    size_t getVertexCount() const { return vertices.size(); }
+    bool isEmpty() const { return vertices.empty(); }
+
+private:
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+    void pushQuad(sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Vector2f d, sf::Color color);
+    const std::vector<sf::Vector2f>& unitCircle(size_t pointCount);
+
+    Usage usage;
+    std::vector<sf::Vertex> vertices;
+
+    // Static layers only; refreshed lazily from draw()
+    mutable sf::VertexBuffer buffer;
+    mutable bool uploaded = false;
+
+    std::vector<sf::Vector2f> circlePoints; // Unit circle for the last pointCount
+};
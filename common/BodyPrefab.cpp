@@ -0,0 +1,41 @@
+#include "BodyPrefab.hpp"
+
+#include <algorithm>
+
+BodyPrefab makeBoxPrefab(sf::Vector2f size, float scale, b2BodyType type, uint16_t archetype) {
+    BodyPrefab prefab;
+    prefab.bodyDef = b2DefaultBodyDef();
+    prefab.bodyDef.type = type;
+    prefab.polygon = b2MakeBox(size.x / 2 / scale, size.y / 2 / scale);
+    prefab.shapeDef = b2DefaultShapeDef();
+    prefab.shapeDef.density = 1.0f;
+    prefab.archetype = archetype;
+    return prefab;
+}
+
+b2BodyId createPrefabBody(b2WorldId worldId, const BodyPrefab& prefab, b2Transform transform) {
+    b2BodyDef bodyDef = prefab.bodyDef;
+    bodyDef.position = transform.p;
+    bodyDef.rotation = transform.q;
+    b2BodyId bodyId = b2CreateBody(worldId, &bodyDef);
+    b2CreatePolygonShape(bodyId, &prefab.shapeDef, &prefab.polygon);
+    return bodyId;
+}
+
+uint32_t spawnPrefab(b2WorldId worldId, const BodyPrefab& prefab, const b2Transform* transforms, size_t count,
+                     BodyRegistry* registry, std::vector<b2BodyId>* bodies) {
+    uint32_t first = registry ? (uint32_t)registry->size() : 0;
+    if (registry)
+        registry->reserve(registry->size() + count);
+    if (bodies && bodies->size() + count > bodies->capacity())
+        bodies->reserve(std::max(bodies->size() + count, bodies->capacity() * 2));
+
+    for (size_t i = 0; i < count; i++) {
+        b2BodyId bodyId = createPrefabBody(worldId, prefab, transforms[i]);
+        if (registry)
+            registry->create(bodyId, prefab.archetype);
+        if (bodies)
+            bodies->push_back(bodyId);
+    }
+    return first;
+}
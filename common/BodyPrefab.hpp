@@ -0,0 +1,32 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <box2d/box2d.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "BodyRegistry.hpp"
+
+// What every body of one kind shares, built once instead of per body: the
+// body def (position and rotation are filled in per body), the polygon, the
+// shape def and the registry archetype it's drawn with.
+struct BodyPrefab {
+    b2BodyDef bodyDef;
+    b2Polygon polygon;
+    b2ShapeDef shapeDef;
+    uint16_t archetype = 0;
+};
+
+// A box of `size` pixels, density 1 and Box2D's default friction; adjust
+// the defs afterwards for anything else
+BodyPrefab makeBoxPrefab(sf::Vector2f size, float scale, b2BodyType type, uint16_t archetype);
+
+// One body of `prefab` at `transform` (meters)
+b2BodyId createPrefabBody(b2WorldId worldId, const BodyPrefab& prefab, b2Transform transform);
+
+// Create `count` bodies of `prefab`. With a registry, its arrays are grown
+// once for the whole batch and every body gets an entry with the prefab's
+// archetype; the result is the first new index. Body ids also go to `bodies`
+// when given.
+uint32_t spawnPrefab(b2WorldId worldId, const BodyPrefab& prefab, const b2Transform* transforms, size_t count,
+                     BodyRegistry* registry, std::vector<b2BodyId>* bodies = nullptr);
@@ -0,0 +1,96 @@
+#include "BodyRegistry.hpp"
+
+#include <algorithm>
+
+uint16_t BodyRegistry::addArchetype(sf::Vector2f size, sf::Color color) {
+    archetypes.push_back({size, color});
+    return (uint16_t)(archetypes.size() - 1);
+}
+
+uint32_t BodyRegistry::create(b2BodyId bodyId, uint16_t archetype) {
+    uint32_t index = (uint32_t)bodies.size();
+    bodies.push_back(bodyId);
+    archetypeOf.push_back(archetype);
+    colors.push_back(archetypes[archetype].color);
+    flags.push_back(0);
+
+    b2Body_SetUserData(bodyId, TransformSync::slotUserData(index));
+    sync.setSlot(index, bodyId);
+    return index;
+}
+
+void BodyRegistry::reserve(size_t count) {
+    // Still at least double, so a run of small batches doesn't reallocate
+    // on every one of them
+    if (count <= bodies.capacity())
+        return;
+    count = std::max(count, bodies.capacity() * 2);
+    sync.reserve(count);
+    bodies.reserve(count);
+    archetypeOf.reserve(count);
+    colors.reserve(count);
+    flags.reserve(count);
+}
+
+void BodyRegistry::remove(uint32_t index) {
+    uint32_t last = (uint32_t)bodies.size() - 1;
+    if (index != last) {
+        bodies[index] = bodies[last];
+        archetypeOf[index] = archetypeOf[last];
+        colors[index] = colors[last];
+        flags[index] = flags[last];
+        b2Body_SetUserData(bodies[index], TransformSync::slotUserData(index));
+        sync.setSlot(index, bodies[index]);
+    }
+    bodies.pop_back();
+    archetypeOf.pop_back();
+    colors.pop_back();
+    flags.pop_back();
+}
+
+void BodyRegistry::appendTo(BatchLayer& layer, float alpha) const {
+    layer.reserveQuads(layer.getVertexCount() / 6 + bodies.size());
+    for (uint32_t i = 0; i < bodies.size(); i++) {
+        if (flags[i] & BODY_HIDDEN)
+            continue;
+        // Bodies that didn't move last step blend to where they already are
+        RenderTransform transform = sync.getInterpolated(i, alpha);
+        layer.addQuad(sf::Vector2f(transform.x, transform.y), archetypes[archetypeOf[i]].size, transform.angle, colors[i]);
+    }
+}
+
+bool BodyRegistry::collectVisible(b2ShapeId shapeId, void* context) {
+    const BodyRegistry* registry = static_cast<const BodyRegistry*>(context);
+    b2BodyId bodyId = b2Shape_GetBody(shapeId);
+    // Skip bodies that aren't in this registry (ground, players, static scenery)
+    uint32_t index;
+    if (TransformSync::slotOf(b2Body_GetUserData(bodyId), index) && index < registry->bodies.size() &&
+        B2_ID_EQUALS(registry->bodies[index], bodyId))
+        registry->visible.push_back(index);
+    return true; // Keep going
+}
+
+size_t BodyRegistry::appendVisible(BatchLayer& layer, b2WorldId worldId, sf::FloatRect view, float alpha) const {
+    // A meter of slack for bodies drawn up to a step behind where Box2D has them
+    float scale = sync.getScale();
+    b2AABB box = {(b2Vec2){view.left / scale - 1.0f, view.top / scale - 1.0f},
+                  (b2Vec2){(view.left + view.width) / scale + 1.0f, (view.top + view.height) / scale + 1.0f}};
+    visible.clear();
+    b2World_OverlapAABB(worldId, box, b2DefaultQueryFilter(), collectVisible, (void*)this);
+
+    // One entry per body however many shapes it has, in index order so the
+    // draw order doesn't depend on the broad phase's
+    std::sort(visible.begin(), visible.end());
+    visible.erase(std::unique(visible.begin(), visible.end()), visible.end());
+
+    layer.reserveQuads(layer.getVertexCount() / 6 + visible.size());
+    size_t added = 0;
+    for (uint32_t i : visible) {
+        if (flags[i] & BODY_HIDDEN)
+            continue;
+        RenderTransform transform = sync.getInterpolated(i, alpha);
+        layer.addQuad(sf::Vector2f(transform.x, transform.y), archetypes[archetypeOf[i]].size, transform.angle, colors[i]);
+        ++added;
+    }
+    return added;
+}
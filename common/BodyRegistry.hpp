@@ -0,0 +1,90 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <box2d/box2d.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "BatchLayer.hpp"
+#include "TransformSync.hpp"
+
+// What every body of one kind shares: its drawn size (pixels, centred on
+// the body) and starting colour
+struct BodyArchetype {
+    sf::Vector2f size;
+    sf::Color color;
+};
+
+// Per-body flag bits
+const uint8_t BODY_HIDDEN = 1; // Kept (and pooled) but not drawn
+
+// Render-side bodies as dense component arrays, one entry per body:
+// Box2D id, transform (via TransformSync, so only moved bodies are
+// touched), archetype, colour and flags. Size and the rest of the look live
+// once per archetype instead of once per body, so a body costs a few dozen
+// bytes rather than an sf::RectangleShape, and the sync and render passes
+// walk packed arrays.
+//
+// Index i's body carries TransformSync::slotUserData(i) as its user data.
+// remove() moves the last body into the hole, like the vectors it replaces,
+// so indices are only stable until the next remove.
+class BodyRegistry {
+public:
+    // `scale` converts Box2D meters to pixels
+    explicit BodyRegistry(float scale) : sync(scale) {}
+
+    uint16_t addArchetype(sf::Vector2f size, sf::Color color);
+
+    // Append a body; returns its index. The body itself stays the caller's.
+    uint32_t create(b2BodyId bodyId, uint16_t archetype);
+
+    // Grow every array to hold `count` bodies at once, ahead of a bulk spawn
+    void reserve(size_t count);
+    void remove(uint32_t index);
+
+    // Re-read a body's transform after teleporting it outside a step
+    void resetTransform(uint32_t index) { sync.setSlot(index, bodies[index]); }
+
+    // Apply this step's move events; call once after every b2World_Step
+    size_t update(b2WorldId worldId) { return sync.update(worldId); }
+    const std::vector<uint32_t>& getMovedSlots() const { return sync.getMovedSlots(); }
+
+    size_t size() const { return bodies.size(); }
+    b2BodyId getBody(uint32_t index) const { return bodies[index]; }
+    const RenderTransform& getTransform(uint32_t index) const { return sync.getTransform(index); }
+    const BodyArchetype& getArchetype(uint32_t index) const { return archetypes[archetypeOf[index]]; }
+    sf::Color getColor(uint32_t index) const { return colors[index]; }
+    void setColor(uint32_t index, sf::Color color) { colors[index] = color; }
+    uint8_t getFlags(uint32_t index) const { return flags[index]; }
+    void setFlags(uint32_t index, uint8_t value) { flags[index] = value; }
+
+    // One rotated quad per visible body, `alpha` of the way between its last
+    // two steps (GameLoop::getAlpha())
+    void appendTo(BatchLayer& layer, float alpha = 1.0f) const;
+
+    // The same for just the bodies overlapping `view` (pixels, e.g.
+    // Camera::getVisibleRect()), found with an AABB query on Box2D's broad
+    // phase instead of a walk over every body, so the cost follows what is on
+    // screen rather than the world's population. Returns how many were added.
+    size_t appendVisible(BatchLayer& layer, b2WorldId worldId, sf::FloatRect view, float alpha = 1.0f) const;
+    // Indices the last appendVisible() found, in order, hidden ones included
+    const std::vector<uint32_t>& getVisible() const { return visible; }
+
+    // Component bytes per body, including the previous transform kept for
+    // interpolation
+    static size_t getBytesPerBody() {
+        return sizeof(b2BodyId) + 2 * sizeof(RenderTransform) + sizeof(uint16_t) + sizeof(sf::Color) + sizeof(uint8_t);
+    }
+
+private:
+    static bool collectVisible(b2ShapeId shapeId, void* context);
+
+    TransformSync sync;
+    std::vector<BodyArchetype> archetypes;
+    std::vector<b2BodyId> bodies;
+    std::vector<uint16_t> archetypeOf;
+    std::vector<sf::Color> colors;
+    std::vector<uint8_t> flags;
+
+    mutable std::vector<uint32_t> visible; // appendVisible() scratch
+};
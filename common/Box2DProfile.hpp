@@ -0,0 +1,24 @@
+#pragma once
+
+#include <box2d/box2d.h>
+#include "Profiler.hpp"
+
+// Add Box2D's own breakdown of the last b2World_Step (milliseconds) and its
+// world counters to the profiler's current frame. Call after the step.
+inline void recordBox2DProfile(Profiler& profiler, b2WorldId worldId) {
+    if (!profiler.isEnabled())
+        return;
+
+    b2Profile profile = b2World_GetProfile(worldId);
+    profiler.setValue("box2d step ms", profile.step);
+    profiler.setValue("box2d pairs ms", profile.pairs);
+    profiler.setValue("box2d collide ms", profile.collide);
+    profiler.setValue("box2d solve ms", profile.solve);
+    profiler.setValue("box2d continuous ms", profile.continuous);
+
+    b2Counters counters = b2World_GetCounters(worldId);
+    profiler.setValue("box2d bodies", counters.bodyCount);
+    profiler.setValue("box2d contacts", counters.contactCount);
+    profiler.setValue("box2d islands", counters.islandCount);
+    profiler.setValue("box2d tasks", counters.taskCount);
+}
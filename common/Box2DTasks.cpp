@@ -0,0 +1,92 @@
+#include "Box2DTasks.hpp"
+
+#include <algorithm>
+#include <thread>
+
+Box2DTaskScheduler::Box2DTaskScheduler(ThreadPool& pool)
+    : pool(pool), workerCount(std::min(pool.getThreadCount(), MAX_WORKERS)) {
+    freeWorkers = workerCount == MAX_WORKERS ? ~(uint64_t)0 : ((uint64_t)1 << workerCount) - 1;
+}
+
+void Box2DTaskScheduler::attach(b2WorldDef& def) {
+    def.workerCount = (int32_t)workerCount;
+    def.enqueueTask = enqueueTask;
+    def.finishTask = finishTask;
+    def.userTaskContext = this;
+}
+
+void* Box2DTaskScheduler::enqueueTask(b2TaskCallback* callback, int32_t itemCount, int32_t minRange, void* taskContext,
+                                      void* userContext) {
+    Box2DTaskScheduler* scheduler = static_cast<Box2DTaskScheduler*>(userContext);
+    ++scheduler->taskTotal;
+
+    // Box2D treats a null handle as "already done". Running a solver task
+    // inline could hang: its workers spin until the main worker posts each
+    // stage, and the main worker may still be queued behind them. MAX_TASKS
+    // leaves room for all of them, so only a task that needs nothing else to
+    // finish can land here.
+    if (scheduler->usedTasks == MAX_TASKS) {
+        callback(0, itemCount, 0, taskContext);
+        return nullptr;
+    }
+
+    Task& task = scheduler->tasks[scheduler->usedTasks++];
+    ++scheduler->openTasks;
+    task.scheduler = scheduler;
+    task.callback = callback;
+    task.context = taskContext;
+
+    // A few chunks per thread so stealing can even out the work, but never
+    // smaller than Box2D asks for
+    size_t chunks = (size_t)scheduler->pool.getThreadCount() * 4;
+    size_t grain = std::max<size_t>((size_t)std::max(minRange, 1), ((size_t)itemCount + chunks - 1) / chunks);
+    scheduler->pool.submit(task.group, (size_t)itemCount, grain, runRange, &task);
+    return &task;
+}
+
+void Box2DTaskScheduler::finishTask(void* userTask, void* userContext) {
+    Box2DTaskScheduler* scheduler = static_cast<Box2DTaskScheduler*>(userContext);
+    Task& task = *static_cast<Task*>(userTask);
+    scheduler->pool.wait(task.group);
+
+    // Slots are recycled once the step has nothing in flight
+    if (--scheduler->openTasks == 0)
+        scheduler->usedTasks = 0;
+}
+
+void Box2DTaskScheduler::runRange(size_t begin, size_t end, unsigned threadIndex, void* context) {
+    Task& task = *static_cast<Task*>(context);
+    Box2DTaskScheduler* scheduler = task.scheduler;
+    PROFILE_SCOPE(scheduler->profiler, "box2d task");
+    if (scheduler->pool.getThreadCount() <= MAX_WORKERS) {
+        task.callback((int32_t)begin, (int32_t)end, threadIndex, task.context);
+        return;
+    }
+
+    // More pool threads than Box2D workers: no two running chunks may share
+    // an index, so each borrows a free one for its duration
+    unsigned worker = scheduler->claimWorker();
+    task.callback((int32_t)begin, (int32_t)end, worker, task.context);
+    scheduler->releaseWorker(worker);
+}
+
+unsigned Box2DTaskScheduler::claimWorker() {
+    // Every holder is either a chunk that finishes on its own or one of the
+    // solver's workerCount tasks, which all fit, so a wait here always ends
+    for (;;) {
+        uint64_t free = freeWorkers.load(std::memory_order_acquire);
+        if (free == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        unsigned worker = 0;
+        while (!(free & ((uint64_t)1 << worker)))
+            ++worker;
+        if (freeWorkers.compare_exchange_weak(free, free & ~((uint64_t)1 << worker), std::memory_order_acquire))
+            return worker;
+    }
+}
+
+void Box2DTaskScheduler::releaseWorker(unsigned worker) {
+    freeWorkers.fetch_or((uint64_t)1 << worker, std::memory_order_release);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <box2d/box2d.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "Profiler.hpp"
+#include "ThreadPool.hpp"
+
+// Runs Box2D's internal tasks on a ThreadPool through the b2WorldDef worker
+// hooks (workerCount / enqueueTask / finishTask), so b2World_Step uses every
+// pool thread instead of one. Box2D's worker index is the pool's thread
+// index, so per-worker scratch never overlaps. Box2D has at most MAX_WORKERS
+// workers; a bigger pool borrows a free worker index for each chunk instead.
+//
+// One scheduler per world; it must outlive the world, and the world must be
+// stepped from the thread that created the pool.
+class Box2DTaskScheduler {
+public:
+    // Box2D's b2_maxWorkers, which its public headers don't export
+    static const unsigned MAX_WORKERS = 64;
+
+    explicit Box2DTaskScheduler(ThreadPool& pool);
+
+    Box2DTaskScheduler(const Box2DTaskScheduler&) = delete;
+    Box2DTaskScheduler& operator=(const Box2DTaskScheduler&) = delete;
+
+    // Point the world definition's worker hooks at this scheduler
+    void attach(b2WorldDef& def);
+
+    // Tasks Box2D enqueued since construction (handy for checking it's on)
+    size_t getTaskCount() const { return taskTotal; }
+
+    // Time every chunk of Box2D work as "box2d task" on the thread running it
+    void setProfiler(Profiler* value) { profiler = value; }
+
+private:
+    // The most Box2D has open at once is one solver task per worker plus a
+    // few single tasks (pair update, tree rebuild, continuous), so every
+    // solver task always gets a slot
+    static const int MAX_TASKS = MAX_WORKERS + 16;
+
+    struct Task {
+        Box2DTaskScheduler* scheduler = nullptr;
+        b2TaskCallback* callback = nullptr;
+        void* context = nullptr;
+        ThreadPool::TaskGroup group;
+    };
+
+    static void* enqueueTask(b2TaskCallback* callback, int32_t itemCount, int32_t minRange, void* taskContext, void* userContext);
+    static void finishTask(void* userTask, void* userContext);
+    static void runRange(size_t begin, size_t end, unsigned threadIndex, void* context);
+    unsigned claimWorker();
+    void releaseWorker(unsigned worker);
+
+    ThreadPool& pool;
+    unsigned workerCount;                // What Box2D was told, at most MAX_WORKERS
+    std::atomic<uint64_t> freeWorkers{0}; // Unclaimed worker indices when the pool is bigger
+    Profiler* profiler = nullptr;
+    Task tasks[MAX_TASKS];
+    int usedTasks = 0; // Slots handed out since every task was last finished
+    int openTasks = 0; // Enqueued but not finished yet
+    size_t taskTotal = 0;
+};
@@ -0,0 +1,238 @@
+#include "BroadPhase.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "SimdLanes.hpp"
+
+namespace {
+
+const float EMPTY_MIN = std::numeric_limits<float>::infinity();
+const float EMPTY_MAX = -std::numeric_limits<float>::infinity();
+
+uint32_t hashCell(int32_t x, int32_t y) {
+    return (uint32_t)x * 73856093u ^ (uint32_t)y * 19349663u;
+}
+
+// Test box i of the sorted arrays against boxes [begin, end) and call
+// hit(j) for each overlap. Strict comparisons, like sf::FloatRect::intersects.
+template <typename Hit>
+void testAgainst(const float* minX, const float* minY, const float* maxX, const float* maxY,
+                 size_t i, size_t begin, size_t end, Hit hit) {
+    size_t j = begin;
+
+#if defined(SIMD_LANES_ENABLED)
+    using namespace simd;
+    const Lanes aMinX = splat(minX[i]), aMinY = splat(minY[i]);
+    const Lanes aMaxX = splat(maxX[i]), aMaxY = splat(maxY[i]);
+    for (; j + LANES <= end; j += LANES) {
+        int mask = lessMask(load(minX + j), aMaxX) & lessMask(aMinX, load(maxX + j)) &
+                   lessMask(load(minY + j), aMaxY) & lessMask(aMinY, load(maxY + j));
+        for (unsigned lane = 0; mask != 0; ++lane, mask >>= 1) {
+            if (mask & 1)
+                hit(j + lane);
+        }
+    }
+#endif
+
+    for (; j < end; ++j) {
+        if (minX[j] < maxX[i] && minX[i] < maxX[j] && minY[j] < maxY[i] && minY[i] < maxY[j])
+            hit(j);
+    }
+}
+
+} // namespace
+
+BroadPhase::BroadPhase(BroadPhaseMethod method, float cellSize)
+    : method(method), cellSize(cellSize), invCellSize(1.0f / cellSize) {
+}
+
+uint32_t BroadPhase::insert(const sf::FloatRect& bounds) {
+    uint32_t proxy;
+    if (!freeIds.empty()) {
+        proxy = freeIds.back();
+        freeIds.pop_back();
+    } else {
+        proxy = (uint32_t)alive.size();
+        minX.push_back(EMPTY_MIN);
+        minY.push_back(EMPTY_MIN);
+        maxX.push_back(EMPTY_MAX);
+        maxY.push_back(EMPTY_MAX);
+        alive.push_back(0);
+        inSweep.push_back(0);
+    }
+
+    alive[proxy] = 1;
+    ++liveCount;
+    move(proxy, bounds);
+    if (!inSweep[proxy]) {
+        sweepOrder.push_back(proxy);
+        inSweep[proxy] = 1;
+    }
+    return proxy;
+}
+
+void BroadPhase::move(uint32_t proxy, const sf::FloatRect& bounds) {
+    minX[proxy] = bounds.left;
+    minY[proxy] = bounds.top;
+    maxX[proxy] = bounds.left + bounds.width;
+    maxY[proxy] = bounds.top + bounds.height;
+}
+
+void BroadPhase::remove(uint32_t proxy) {
+    if (proxy >= alive.size() || !alive[proxy])
+        return;
+    alive[proxy] = 0;
+    minX[proxy] = minY[proxy] = EMPTY_MIN;
+    maxX[proxy] = maxY[proxy] = EMPTY_MAX;
+    freeIds.push_back(proxy);
+    --liveCount;
+    // sweepOrder drops it on the next sweep
+}
+
+sf::FloatRect BroadPhase::getBounds(uint32_t proxy) const {
+    return sf::FloatRect(minX[proxy], minY[proxy], maxX[proxy] - minX[proxy], maxY[proxy] - minY[proxy]);
+}
+
+int BroadPhase::cellOf(float coordinate) const {
+    return (int)std::floor(coordinate * invCellSize);
+}
+
+void BroadPhase::findPairs(std::vector<Pair>& pairs) {
+    pairs.clear();
+    if (method == BroadPhaseMethod::UniformGrid) {
+        findPairsGrid(pairs);
+    } else {
+        findPairsSweep(pairs);
+    }
+}
+
+void BroadPhase::findPairsGrid(std::vector<Pair>& pairs) {
+    // One entry per cell each live box covers
+    entryBucket.clear();
+    entryProxy.clear();
+    entryCellX.clear();
+    entryCellY.clear();
+    for (uint32_t proxy = 0; proxy < alive.size(); ++proxy) {
+        if (!alive[proxy])
+            continue;
+        int x0 = cellOf(minX[proxy]), x1 = cellOf(maxX[proxy]);
+        int y0 = cellOf(minY[proxy]), y1 = cellOf(maxY[proxy]);
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                entryProxy.push_back(proxy);
+                entryCellX.push_back(x);
+                entryCellY.push_back(y);
+            }
+        }
+    }
+
+    // Hash table with at least twice as many buckets as entries
+    size_t bucketCount = 16;
+    while (bucketCount < entryProxy.size() * 2)
+        bucketCount *= 2;
+    uint32_t bucketMask = (uint32_t)bucketCount - 1;
+
+    bucketStart.assign(bucketCount + 1, 0);
+    entryBucket.resize(entryProxy.size());
+    for (size_t e = 0; e < entryProxy.size(); ++e) {
+        entryBucket[e] = hashCell(entryCellX[e], entryCellY[e]) & bucketMask;
+        ++bucketStart[entryBucket[e] + 1];
+    }
+    for (size_t b = 1; b < bucketStart.size(); ++b) {
+        bucketStart[b] += bucketStart[b - 1];
+    }
+
+    // Scatter, copying bounds next to each other for the lane tests
+    size_t entryCount = entryProxy.size();
+    sortedProxy.resize(entryCount);
+    sortedCellX.resize(entryCount);
+    sortedCellY.resize(entryCount);
+    sortedMinX.resize(entryCount);
+    sortedMinY.resize(entryCount);
+    sortedMaxX.resize(entryCount);
+    sortedMaxY.resize(entryCount);
+    for (size_t e = 0; e < entryCount; ++e) {
+        uint32_t slot = bucketStart[entryBucket[e]]++;
+        uint32_t proxy = entryProxy[e];
+        sortedProxy[slot] = proxy;
+        sortedCellX[slot] = entryCellX[e];
+        sortedCellY[slot] = entryCellY[e];
+        sortedMinX[slot] = minX[proxy];
+        sortedMinY[slot] = minY[proxy];
+        sortedMaxX[slot] = maxX[proxy];
+        sortedMaxY[slot] = maxY[proxy];
+    }
+    for (size_t b = bucketCount; b > 0; --b) {
+        bucketStart[b] = bucketStart[b - 1];
+    }
+    bucketStart[0] = 0;
+
+    // A pair is reported only in the cell holding the top-left corner of the
+    // two boxes' intersection, so boxes sharing several cells count once.
+    // Hash collisions put foreign cells in a bucket; the cell check skips them.
+    for (size_t b = 0; b < bucketCount; ++b) {
+        size_t begin = bucketStart[b], end = bucketStart[b + 1];
+        for (size_t i = begin; i + 1 < end; ++i) {
+            testAgainst(sortedMinX.data(), sortedMinY.data(), sortedMaxX.data(), sortedMaxY.data(), i, i + 1, end,
+                        [&](size_t j) {
+                if (sortedCellX[i] != sortedCellX[j] || sortedCellY[i] != sortedCellY[j])
+                    return;
+                if (cellOf(std::max(sortedMinX[i], sortedMinX[j])) != sortedCellX[i] ||
+                    cellOf(std::max(sortedMinY[i], sortedMinY[j])) != sortedCellY[i])
+                    return;
+                uint32_t a = sortedProxy[i], c = sortedProxy[j];
+                pairs.push_back(a < c ? Pair(a, c) : Pair(c, a));
+            });
+        }
+    }
+}
+
+void BroadPhase::findPairsSweep(std::vector<Pair>& pairs) {
+    // Drop removed proxies, then insertion sort: boxes move a little per
+    // frame, so the order from last time is almost right
+    sweepOrder.erase(std::remove_if(sweepOrder.begin(), sweepOrder.end(),
+                                    [&](uint32_t proxy) {
+                                        if (alive[proxy])
+                                            return false;
+                                        inSweep[proxy] = 0;
+                                        return true;
+                                    }),
+                     sweepOrder.end());
+    for (size_t i = 1; i < sweepOrder.size(); ++i) {
+        uint32_t proxy = sweepOrder[i];
+        float key = minX[proxy];
+        size_t j = i;
+        while (j > 0 && minX[sweepOrder[j - 1]] > key) {
+            sweepOrder[j] = sweepOrder[j - 1];
+            --j;
+        }
+        sweepOrder[j] = proxy;
+    }
+
+    size_t count = sweepOrder.size();
+    sortedMinX.resize(count);
+    sortedMinY.resize(count);
+    sortedMaxX.resize(count);
+    sortedMaxY.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t proxy = sweepOrder[i];
+        sortedMinX[i] = minX[proxy];
+        sortedMinY[i] = minY[proxy];
+        sortedMaxX[i] = maxX[proxy];
+        sortedMaxY[i] = maxY[proxy];
+    }
+
+    // Everything that can overlap box i starts before its right edge
+    for (size_t i = 0; i < count; ++i) {
+        float right = sortedMaxX[i];
+        size_t end = i + 1;
+        while (end < count && sortedMinX[end] < right)
+            ++end;
+        testAgainst(sortedMinX.data(), sortedMinY.data(), sortedMaxX.data(), sortedMaxY.data(), i, i + 1, end,
+                    [&](size_t j) {
+            uint32_t a = sweepOrder[i], c = sweepOrder[j];
+            pairs.push_back(a < c ? Pair(a, c) : Pair(c, a));
+        });
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// How BroadPhase finds overlapping pairs
+enum class BroadPhaseMethod {
+    UniformGrid,  // Hash every box into fixed-size cells, test boxes sharing a cell
+    SweepAndPrune // Keep boxes sorted by left edge, test along the sweep
+};
+
+// Overlap detection for many moving axis-aligned boxes without a physics
+// engine. Boxes are proxies with stable ids; moving one only rewrites its
+// bounds. findPairs rebuilds whatever the method needs from the current
+// bounds (a counting-sorted cell table, or an insertion sort that is nearly
+// free when boxes moved a little) and tests candidates in SIMD lanes.
+//
+// Overlap means the same as sf::FloatRect::intersects: touching edges don't
+// count.
+class BroadPhase {
+public:
+    typedef std::pair<uint32_t, uint32_t> Pair; // first < second
+
+    explicit BroadPhase(BroadPhaseMethod method = BroadPhaseMethod::UniformGrid, float cellSize = 64.f);
+
+    uint32_t insert(const sf::FloatRect& bounds);
+    void move(uint32_t proxy, const sf::FloatRect& bounds);
+    void remove(uint32_t proxy);
+
+    sf::FloatRect getBounds(uint32_t proxy) const;
+    size_t size() const { return liveCount; }
+
+    void setMethod(BroadPhaseMethod value) { method = value; }
+    BroadPhaseMethod getMethod() const { return method; }
+
+    // Every overlapping pair exactly once, replacing the contents of `pairs`
+    void findPairs(std::vector<Pair>& pairs);
+
+private:
+    void findPairsGrid(std::vector<Pair>& pairs);
+    void findPairsSweep(std::vector<Pair>& pairs);
+    int cellOf(float coordinate) const;
+
+    BroadPhaseMethod method;
+    float cellSize;
+    float invCellSize;
+
+    // Proxy bounds; removed proxies get empty (inverted) bounds so they
+    // never overlap anything, and their ids are reused
+    std::vector<float> minX, minY, maxX, maxY;
+    std::vector<uint8_t> alive;
+    std::vector<uint32_t> freeIds;
+    size_t liveCount = 0;
+
+    // Uniform grid: one entry per (proxy, cell), counting-sorted by cell hash
+    std::vector<uint32_t> bucketStart;
+    std::vector<uint32_t> entryBucket, entryProxy;
+    std::vector<int32_t> entryCellX, entryCellY;
+    std::vector<uint32_t> sortedProxy;
+    std::vector<int32_t> sortedCellX, sortedCellY;
+    std::vector<float> sortedMinX, sortedMinY, sortedMaxX, sortedMaxY;
+
+    // Sweep and prune: proxies by left edge, kept between calls. A removed
+    // proxy stays listed until the next sweep, so a reused id may already be
+    // there; inSweep says whether it is.
+    std::vector<uint32_t> sweepOrder;
+    std::vector<uint8_t> inSweep;
+};
@@ -0,0 +1,112 @@
+#include "Camera.hpp"
+
+#include <algorithm>
+
+Camera::Camera(sf::Vector2f viewSize) : view(sf::FloatRect(0, 0, viewSize.x, viewSize.y)), baseSize(viewSize) {
+}
+
+void Camera::setBounds(sf::FloatRect world) {
+    bounds = world;
+    bounded = true;
+    clampToBounds();
+}
+
+void Camera::setZoomLimits(float minValue, float maxValue) {
+    minZoom = minValue;
+    maxZoom = std::max(minValue, maxValue);
+    zoom = std::max(minZoom, std::min(zoom, maxZoom));
+    view.setSize(baseSize * zoom);
+    clampToBounds();
+}
+
+bool Camera::handleEvent(const sf::Event& event, const sf::RenderWindow& window) {
+    switch (event.type) {
+    case sf::Event::MouseButtonPressed:
+        if (event.mouseButton.button != sf::Mouse::Middle)
+            return false;
+        dragging = true;
+        dragLast = sf::Vector2i(event.mouseButton.x, event.mouseButton.y);
+        return true;
+    case sf::Event::MouseButtonReleased:
+        if (event.mouseButton.button != sf::Mouse::Middle)
+            return false;
+        dragging = false;
+        return true;
+    case sf::Event::MouseMoved: {
+        if (!dragging)
+            return false;
+        // The world follows the cursor
+        sf::Vector2i position(event.mouseMove.x, event.mouseMove.y);
+        pan(sf::Vector2f(dragLast - position));
+        dragLast = position;
+        return true;
+    }
+    case sf::Event::MouseWheelScrolled:
+        if (event.mouseWheelScroll.wheel != sf::Mouse::VerticalWheel)
+            return false;
+        zoomAt(sf::Vector2i(event.mouseWheelScroll.x, event.mouseWheelScroll.y), event.mouseWheelScroll.delta > 0 ? 1 / 1.1f : 1.1f,
+               window);
+        return true;
+    case sf::Event::Resized:
+        baseSize = sf::Vector2f(event.size.width, event.size.height);
+        view.setSize(baseSize * zoom);
+        clampToBounds();
+        return true;
+    case sf::Event::LostFocus:
+        focused = false;
+        dragging = false;
+        return false;
+    case sf::Event::GainedFocus:
+        focused = true;
+        return false;
+    default:
+        return false;
+    }
+}
+
+void Camera::update(float seconds, float speed) {
+    if (!focused)
+        return;
+    sf::Vector2f direction(0, 0);
+    direction.x -= sf::Keyboard::isKeyPressed(sf::Keyboard::Left);
+    direction.x += sf::Keyboard::isKeyPressed(sf::Keyboard::Right);
+    direction.y -= sf::Keyboard::isKeyPressed(sf::Keyboard::Up);
+    direction.y += sf::Keyboard::isKeyPressed(sf::Keyboard::Down);
+    if (direction.x != 0 || direction.y != 0)
+        pan(direction * speed * seconds);
+}
+
+void Camera::pan(sf::Vector2f offset) {
+    // Window pixels cover `zoom` world pixels each
+    view.move(offset * zoom);
+    clampToBounds();
+}
+
+void Camera::zoomAt(sf::Vector2i pixel, float factor, const sf::RenderTarget& target) {
+    sf::Vector2f before = toWorld(pixel, target);
+    zoom = std::max(minZoom, std::min(zoom * factor, maxZoom));
+    view.setSize(baseSize * zoom);
+    view.move(before - toWorld(pixel, target));
+    clampToBounds();
+}
+
+void Camera::centerOn(sf::Vector2f position) {
+    view.setCenter(position);
+    clampToBounds();
+}
+
+sf::FloatRect Camera::getVisibleRect() const {
+    sf::Vector2f size = view.getSize();
+    return sf::FloatRect(view.getCenter() - size / 2.0f, size);
+}
+
+void Camera::clampToBounds() {
+    if (!bounded)
+        return;
+    sf::Vector2f half = view.getSize() / 2.0f;
+    sf::Vector2f center = view.getCenter();
+    auto clampAxis = [](float value, float low, float high) { return low > high ? (low + high) / 2 : std::max(low, std::min(value, high)); };
+    center.x = clampAxis(center.x, bounds.left + half.x, bounds.left + bounds.width - half.x);
+    center.y = clampAxis(center.y, bounds.top + half.y, bounds.top + bounds.height - half.y);
+    view.setCenter(center);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+// Scrollable, zoomable view onto a world bigger than the window. The middle
+// mouse button drags the world, the wheel zooms about the cursor and the
+// arrow keys pan; a resized window shows more of the world instead of
+// stretching it. Draw the world with getView() and screen-space UI with the
+// window's default view. getVisibleRect() is what culling passes should
+// test against.
+class Camera {
+public:
+    // Starts showing the top-left `viewSize` pixels of the world at 1:1
+    explicit Camera(sf::Vector2f viewSize);
+
+    // Keep the view centre inside `world` (pixels); a view larger than the
+    // world on an axis is centred on it
+    void setBounds(sf::FloatRect world);
+    // Zoom factors allowed; above 1 shows more of the world
+    void setZoomLimits(float minZoom, float maxZoom);
+
+    // Returns true if the event moved or zoomed the camera
+    bool handleEvent(const sf::Event& event, const sf::RenderWindow& window);
+    // Arrow-key panning, `speed` window pixels per second
+    void update(float seconds, float speed = 600.0f);
+
+    // Move by `offset` window pixels / zoom by `factor` keeping the world
+    // point under `pixel` where it is
+    void pan(sf::Vector2f offset);
+    void zoomAt(sf::Vector2i pixel, float factor, const sf::RenderTarget& target);
+    void centerOn(sf::Vector2f position);
+
+    const sf::View& getView() const { return view; }
+    float getZoom() const { return zoom; }
+    // World rectangle on screen, in pixels
+    sf::FloatRect getVisibleRect() const;
+    // Window pixel to world pixels, e.g. for mouse clicks
+    sf::Vector2f toWorld(sf::Vector2i pixel, const sf::RenderTarget& target) const { return target.mapPixelToCoords(pixel, view); }
+
+private:
+    void clampToBounds();
+
+    sf::View view;
+    sf::Vector2f baseSize; // Window size, the view's size at zoom 1
+    float zoom = 1.0f;
+    float minZoom = 0.25f;
+    float maxZoom = 8.0f;
+
+    sf::FloatRect bounds;
+    bool bounded = false;
+
+    bool dragging = false;
+    sf::Vector2i dragLast;
+    bool focused = true; // Arrow keys only pan while the window has focus
+};
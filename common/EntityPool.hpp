@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Reference to a pooled entity. The generation changes every time the slot
+// is freed, so a handle kept past its entity's lifetime stops resolving
+// instead of pointing at whatever reused the slot.
+struct EntityHandle {
+    uint32_t index = 0;
+    uint32_t generation = 0; // Live slots never have generation 0
+
+    bool operator==(const EntityHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+};
+
+// Fixed-growth pool of T with generation-checked handles. Freed slots are
+// reused before the pool grows, and a reused slot keeps its old T, so
+// expensive members (shapes, physics bodies) can be recycled instead of
+// rebuilt; create() reports whether the slot is fresh.
+//
+// Pointers from get() are only valid until the next create(), like any
+// vector element; keep handles across frames, not pointers.
+template <typename T>
+class EntityPool {
+public:
+    explicit EntityPool(size_t reserve = 0) {
+        items.reserve(reserve);
+        generations.reserve(reserve);
+    }
+
+    // Take a free slot (or grow). `reused` is set when the slot's T came
+    // from an earlier entity rather than being default-constructed.
+    EntityHandle create(bool* reused = nullptr) {
+        uint32_t index;
+        if (!freeSlots.empty()) {
+            index = freeSlots.back();
+            freeSlots.pop_back();
+            if (reused)
+                *reused = true;
+        } else {
+            index = (uint32_t)items.size();
+            items.emplace_back();
+            generations.push_back(0);
+            if (reused)
+                *reused = false;
+        }
+
+        // Odd generations are live, even ones free
+        ++generations[index];
+        ++liveCount;
+        return EntityHandle{index, generations[index]};
+    }
+
+    void destroy(EntityHandle handle) {
+        if (!isValid(handle))
+            return;
+        ++generations[handle.index];
+        freeSlots.push_back(handle.index);
+        --liveCount;
+    }
+
+    bool isValid(EntityHandle handle) const {
+        return handle.index < generations.size() && generations[handle.index] == handle.generation && (handle.generation & 1);
+    }
+
+    // Null for stale or null handles
+    T* get(EntityHandle handle) { return isValid(handle) ? &items[handle.index] : nullptr; }
+    const T* get(EntityHandle handle) const { return isValid(handle) ? &items[handle.index] : nullptr; }
+
+    // Handle of the live entity in slot `index`, or a null handle. Lets
+    // code that only stored the index (e.g. in physics user data) get back
+    // to a checked handle.
+    EntityHandle getHandle(uint32_t index) const {
+        if (index < generations.size() && (generations[index] & 1))
+            return EntityHandle{index, generations[index]};
+        return EntityHandle();
+    }
+
+    // Live entities
+    size_t size() const { return liveCount; }
+
+    // Slots ever allocated (live + free); stays flat once spawning and
+    // despawning balance out
+    size_t getSlotCount() const { return items.size(); }
+
+    // Visit live entities as fn(handle, item), in slot order. Destroying the
+    // visited entity from inside fn is allowed.
+    template <typename Fn>
+    void forEach(Fn fn) {
+        for (uint32_t index = 0; index < items.size(); ++index) {
+            if (generations[index] & 1)
+                fn(EntityHandle{index, generations[index]}, items[index]);
+        }
+    }
+
+    template <typename Fn>
+    void forEach(Fn fn) const {
+        for (uint32_t index = 0; index < items.size(); ++index) {
+            if (generations[index] & 1)
+                fn(EntityHandle{index, generations[index]}, items[index]);
+        }
+    }
+
+private:
+    std::vector<T> items;
+    std::vector<uint32_t> generations;
+    std::vector<uint32_t> freeSlots;
+    size_t liveCount = 0;
+};
@@ -0,0 +1,520 @@
+#include "FallbackFont.hpp"
+
+// DejaVu Sans Mono, printable ASCII (U+0020-U+007E) only, hinting and
+// layout tables stripped, 8 KB. Regenerated with fonttools' pyftsubset:
+//   --unicodes="U+0020-007E" --no-hinting --drop-tables+=FFTM,GDEF,GPOS,GSUB,kern
+//
+// Bitstream Vera fonts copyright (c) 2003 Bitstream, Inc.; DejaVu changes
+// are in the public domain. Free to embed and redistribute under the
+// Bitstream Vera license: https://dejavu-fonts.github.io/License.html
+
+const unsigned char FALLBACK_FONT_DATA[] = {
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x80, 0x00, 0x03, 0x00, 0x30, 0x4f, 0x53, 0x2f, 0x32,
+    0x69, 0xf9, 0x70, 0x52, 0x00, 0x00, 0x1d, 0x68, 0x00, 0x00, 0x00, 0x56, 0x63, 0x6d, 0x61, 0x70,
+    0x00, 0x0c, 0x00, 0xd1, 0x00, 0x00, 0x1d, 0xc0, 0x00, 0x00, 0x00, 0x34, 0x67, 0x61, 0x73, 0x70,
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x1f, 0x88, 0x00, 0x00, 0x00, 0x0c, 0x67, 0x6c, 0x79, 0x66,
+    0x60, 0x57, 0xdf, 0x7b, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x1a, 0xa6, 0x68, 0x65, 0x61, 0x64,
+    0x20, 0xdb, 0xe1, 0x9e, 0x00, 0x00, 0x1c, 0x48, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
+    0x08, 0xb6, 0x02, 0x04, 0x00, 0x00, 0x1d, 0x44, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
+    0x26, 0x33, 0x20, 0x02, 0x00, 0x00, 0x1c, 0x80, 0x00, 0x00, 0x00, 0xc2, 0x6c, 0x6f, 0x63, 0x61,
+    0x46, 0x20, 0x3f, 0xc4, 0x00, 0x00, 0x1b, 0x84, 0x00, 0x00, 0x00, 0xc2, 0x6d, 0x61, 0x78, 0x70,
+    0x00, 0x97, 0x02, 0x94, 0x00, 0x00, 0x1b, 0x64, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+    0x1c, 0xf4, 0x36, 0x9e, 0x00, 0x00, 0x1d, 0xf4, 0x00, 0x00, 0x01, 0x74, 0x70, 0x6f, 0x73, 0x74,
+    0xff, 0xdb, 0x00, 0x5b, 0x00, 0x00, 0x1f, 0x68, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x02, 0x04,
+    0x00, 0x00, 0x02, 0xcf, 0x05, 0xd5, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x01, 0x33, 0x11, 0x03,
+    0x23, 0x03, 0x11, 0x33, 0x15, 0x23, 0x02, 0x04, 0xcb, 0x15, 0xa1, 0x15, 0xcb, 0xcb, 0x05, 0xd5,
+    0xfd, 0x71, 0xfe, 0x9b, 0x01, 0x65, 0xfd, 0xb8, 0xfe, 0x00, 0x00, 0x02, 0x01, 0x52, 0x03, 0xaa,
+    0x03, 0x7f, 0x05, 0xd5, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x23, 0x11,
+    0x23, 0x11, 0x03, 0x7f, 0xae, 0xd1, 0xae, 0x05, 0xd5, 0xfd, 0xd5, 0x02, 0x2b, 0xfd, 0xd5, 0x02,
+    0x2b, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x04, 0xcd, 0x05, 0xbe, 0x00, 0x1b, 0x00, 0x1f,
+    0x00, 0x00, 0x01, 0x03, 0x33, 0x13, 0x33, 0x03, 0x33, 0x15, 0x21, 0x03, 0x33, 0x15, 0x21, 0x03,
+    0x23, 0x13, 0x23, 0x03, 0x23, 0x13, 0x21, 0x35, 0x21, 0x13, 0x21, 0x35, 0x21, 0x13, 0x01, 0x23,
+    0x03, 0x33, 0x02, 0xac, 0x68, 0xf5, 0x69, 0xa0, 0x69, 0xf4, 0xfe, 0xe7, 0x54, 0xfa, 0xfe, 0xdf,
+    0x68, 0xa0, 0x69, 0xf6, 0x69, 0x9f, 0x68, 0xfe, 0xfe, 0x01, 0x29, 0x54, 0xfe, 0xf6, 0x01, 0x2f,
+    0x68, 0x01, 0x08, 0xf5, 0x54, 0xf6, 0x05, 0xbe, 0xfe, 0x61, 0x01, 0x9f, 0xfe, 0x61, 0x9a, 0xfe,
+    0xb2, 0x99, 0xfe, 0x62, 0x01, 0x9e, 0xfe, 0x62, 0x01, 0x9e, 0x99, 0x01, 0x4e, 0x9a, 0x01, 0x9f,
+    0xfd, 0xc7, 0xfe, 0xb2, 0x00, 0x03, 0x00, 0xbe, 0xfe, 0xd3, 0x04, 0x5a, 0x06, 0x14, 0x00, 0x06,
+    0x00, 0x0d, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x11, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x11, 0x0e,
+    0x01, 0x15, 0x14, 0x16, 0x13, 0x23, 0x03, 0x2e, 0x01, 0x27, 0x35, 0x1e, 0x01, 0x17, 0x11, 0x2e,
+    0x01, 0x35, 0x34, 0x36, 0x37, 0x35, 0x33, 0x17, 0x1e, 0x01, 0x17, 0x15, 0x2e, 0x01, 0x27, 0x11,
+    0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x02, 0xb4, 0x6e, 0x7c, 0x70, 0xde, 0x68, 0x75, 0x6d, 0xd4,
+    0x64, 0x01, 0x66, 0xc9, 0x62, 0x64, 0xcb, 0x63, 0xc8, 0xca, 0xd3, 0xbf, 0x64, 0x01, 0x4f, 0xa2,
+    0x54, 0x55, 0xa1, 0x50, 0xce, 0xd8, 0xe9, 0xbc, 0x02, 0x44, 0xfe, 0x4e, 0x03, 0x74, 0x64, 0x5d,
+    0x67, 0xd1, 0x01, 0x9d, 0x04, 0x70, 0x5e, 0x56, 0x64, 0xfb, 0xc0, 0x01, 0x2d, 0x05, 0x2e, 0x29,
+    0xb4, 0x3e, 0x42, 0x02, 0x01, 0xca, 0x1f, 0xb6, 0x96, 0x9d, 0xbb, 0x0e, 0xeb, 0xeb, 0x05, 0x1e,
+    0x1a, 0xad, 0x2b, 0x2f, 0x04, 0xfe, 0x51, 0x1f, 0xc2, 0x9a, 0x9a, 0xce, 0x09, 0x00, 0x00, 0x05,
+    0x00, 0x21, 0x00, 0x00, 0x04, 0xb0, 0x05, 0x98, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x1e, 0x00, 0x2a,
+    0x00, 0x39, 0x00, 0x00, 0x01, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
+    0x07, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x01,
+    0x27, 0x01, 0x17, 0x25, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x02, 0xb8,
+    0x69, 0x4e, 0x4d, 0x6b, 0x6c, 0x4c, 0x4e, 0x69, 0x87, 0xb8, 0x86, 0x40, 0x73, 0x2e, 0x2e, 0x32,
+    0xba, 0x87, 0x88, 0xb6, 0xfe, 0x48, 0x23, 0x04, 0x12, 0x29, 0xfc, 0x17, 0x69, 0x4f, 0x4d, 0x6c,
+    0x6c, 0x4d, 0x4d, 0x6b, 0x87, 0xb8, 0x87, 0x40, 0x75, 0x2d, 0x2d, 0x31, 0xba, 0x86, 0x87, 0xb8,
+    0x01, 0x3f, 0x4e, 0x6a, 0x6b, 0x4d, 0x4d, 0x6c, 0x6a, 0x4f, 0x87, 0xb9, 0x30, 0x2e, 0x2f, 0x74,
+    0x3f, 0x85, 0xba, 0xb7, 0x01, 0x1a, 0x60, 0x01, 0xa2, 0x60, 0xe5, 0x4f, 0x69, 0x6b, 0x4d, 0x4d,
+    0x6b, 0x6a, 0x4e, 0x87, 0xb9, 0x30, 0x2d, 0x2d, 0x75, 0x41, 0x86, 0xb9, 0xb8, 0x00, 0x00, 0x02,
+    0x00, 0x39, 0xff, 0xe3, 0x04, 0xc5, 0x05, 0xf0, 0x00, 0x2a, 0x00, 0x37, 0x00, 0x00, 0x09, 0x01,
+    0x3e, 0x01, 0x35, 0x34, 0x2f, 0x01, 0x33, 0x15, 0x14, 0x06, 0x07, 0x17, 0x23, 0x27, 0x0e, 0x01,
+    0x23, 0x22, 0x00, 0x35, 0x34, 0x36, 0x37, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17,
+    0x15, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, 0x33,
+    0x32, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x02, 0x23, 0x01, 0xa0, 0x27, 0x26, 0x03, 0x01, 0xa4, 0x4a,
+    0x4b, 0xaa, 0xd5, 0x4e, 0x53, 0xba, 0x6a, 0xd8, 0xfe, 0xe6, 0x8a, 0x8b, 0x32, 0x30, 0xc7, 0xad,
+    0x41, 0x83, 0x46, 0x3b, 0x7d, 0x45, 0x61, 0x70, 0x3a, 0x36, 0x5c, 0x5b, 0xc8, 0x9b, 0x2a, 0x5c,
+    0x2c, 0x1b, 0x23, 0x10, 0x03, 0x8b, 0xfd, 0xd1, 0x31, 0x96, 0x68, 0x20, 0x46, 0x07, 0x27, 0xa1,
+    0xf3, 0x58, 0xe5, 0x6d, 0x46, 0x44, 0x01, 0x0d, 0xcc, 0x89, 0xea, 0x64, 0x48, 0x8a, 0x47, 0x96,
+    0xae, 0x18, 0x17, 0xb7, 0x27, 0x25, 0x5b, 0x4d, 0x3b, 0x81, 0xcf, 0x49, 0xa3, 0x5c, 0x97, 0xc7,
+    0x18, 0x17, 0x0f, 0x17, 0x0d, 0x00, 0x00, 0x01, 0x02, 0x10, 0x03, 0xaa, 0x02, 0xbe, 0x05, 0xd5,
+    0x00, 0x03, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x02, 0xbe, 0xae, 0x05, 0xd5, 0xfd, 0xd5, 0x02,
+    0x2b, 0x00, 0x00, 0x01, 0x01, 0xaa, 0xfe, 0xf2, 0x03, 0x75, 0x06, 0x12, 0x00, 0x0d, 0x00, 0x00,
+    0x01, 0x06, 0x02, 0x15, 0x14, 0x12, 0x17, 0x23, 0x26, 0x02, 0x35, 0x34, 0x12, 0x37, 0x03, 0x75,
+    0x85, 0x83, 0x83, 0x85, 0xa0, 0x97, 0x94, 0x94, 0x97, 0x06, 0x12, 0xe4, 0xfe, 0x3b, 0xe6, 0xe5,
+    0xfe, 0x3a, 0xe6, 0xee, 0x01, 0xc3, 0xe0, 0xdf, 0x01, 0xc4, 0xec, 0x00, 0x00, 0x01, 0x01, 0x5c,
+    0xfe, 0xf2, 0x03, 0x27, 0x06, 0x12, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x33, 0x16, 0x12, 0x15, 0x14,
+    0x02, 0x07, 0x23, 0x36, 0x12, 0x35, 0x34, 0x02, 0x01, 0x5c, 0xa0, 0x97, 0x94, 0x94, 0x97, 0xa0,
+    0x85, 0x83, 0x83, 0x06, 0x12, 0xec, 0xfe, 0x3c, 0xdf, 0xe1, 0xfe, 0x3c, 0xec, 0xe8, 0x01, 0xc6,
+    0xe3, 0xe4, 0x01, 0xc6, 0x00, 0x01, 0x00, 0xa6, 0x02, 0x4a, 0x04, 0x2b, 0x05, 0xf0, 0x00, 0x11,
+    0x00, 0x00, 0x01, 0x0d, 0x01, 0x07, 0x25, 0x11, 0x23, 0x11, 0x05, 0x27, 0x2d, 0x01, 0x37, 0x05,
+    0x11, 0x33, 0x11, 0x25, 0x04, 0x2b, 0xfe, 0x9a, 0x01, 0x66, 0x39, 0xfe, 0xb0, 0x73, 0xfe, 0xb0,
+    0x39, 0x01, 0x66, 0xfe, 0x9a, 0x39, 0x01, 0x50, 0x73, 0x01, 0x50, 0x04, 0xdf, 0xc2, 0xc3, 0x62,
+    0xcb, 0xfe, 0x87, 0x01, 0x79, 0xcb, 0x62, 0xc3, 0xc2, 0x63, 0xcb, 0x01, 0x79, 0xfe, 0x87, 0xcb,
+    0x00, 0x01, 0x00, 0x58, 0x00, 0x71, 0x04, 0x79, 0x04, 0x93, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x11,
+    0x21, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x35, 0x21, 0x11, 0x02, 0xbc, 0x01, 0xbd, 0xfe, 0x43,
+    0xa8, 0xfe, 0x44, 0x01, 0xbc, 0x04, 0x93, 0xfe, 0x44, 0xaa, 0xfe, 0x44, 0x01, 0xbc, 0xaa, 0x01,
+    0xbc, 0x00, 0x00, 0x01, 0x01, 0x93, 0xfe, 0xe1, 0x02, 0xf2, 0x01, 0x2f, 0x00, 0x05, 0x00, 0x00,
+    0x01, 0x33, 0x15, 0x03, 0x23, 0x13, 0x01, 0xf6, 0xfc, 0xc5, 0x9a, 0x63, 0x01, 0x2f, 0xcf, 0xfe,
+    0x81, 0x01, 0x7f, 0x00, 0x00, 0x01, 0x01, 0x64, 0x01, 0xdf, 0x03, 0x6d, 0x02, 0x83, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x01, 0x64, 0x02, 0x09, 0xfd, 0xf7, 0x02, 0x83, 0xa4, 0x00,
+    0x00, 0x01, 0x01, 0xe9, 0x00, 0x00, 0x02, 0xe5, 0x01, 0x31, 0x00, 0x03, 0x00, 0x00, 0x01, 0x33,
+    0x11, 0x23, 0x01, 0xe9, 0xfc, 0xfc, 0x01, 0x31, 0xfe, 0xcf, 0x00, 0x01, 0x00, 0x66, 0xff, 0x42,
+    0x04, 0x37, 0x05, 0xd5, 0x00, 0x03, 0x00, 0x00, 0x01, 0x33, 0x01, 0x23, 0x03, 0x79, 0xbe, 0xfc,
+    0xee, 0xbf, 0x05, 0xd5, 0xf9, 0x6d, 0x00, 0x03, 0x00, 0x85, 0xff, 0xe3, 0x04, 0x4c, 0x05, 0xf0,
+    0x00, 0x0b, 0x00, 0x17, 0x00, 0x23, 0x00, 0x00, 0x01, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x06, 0x23, 0x22, 0x26, 0x13, 0x22, 0x02, 0x11, 0x10, 0x12, 0x33, 0x32, 0x12, 0x11, 0x10, 0x02,
+    0x27, 0x32, 0x12, 0x11, 0x10, 0x02, 0x23, 0x22, 0x02, 0x11, 0x10, 0x12, 0x01, 0xe3, 0x4d, 0x36,
+    0x38, 0x50, 0x4f, 0x39, 0x38, 0x4b, 0x85, 0x8d, 0x8b, 0x8b, 0x8d, 0x8e, 0x8b, 0x8b, 0x8e, 0xef,
+    0xf5, 0xf5, 0xef, 0xef, 0xf4, 0xf4, 0x02, 0xee, 0x37, 0x50, 0x50, 0x37, 0x38, 0x4e, 0x4c, 0x02,
+    0x9c, 0xfe, 0xd0, 0xfe, 0xc9, 0xfe, 0xca, 0xfe, 0xd0, 0x01, 0x30, 0x01, 0x36, 0x01, 0x37, 0x01,
+    0x30, 0xa0, 0xfe, 0x78, 0xfe, 0x81, 0xfe, 0x82, 0xfe, 0x78, 0x01, 0x88, 0x01, 0x7e, 0x01, 0x7f,
+    0x01, 0x88, 0x00, 0x01, 0x00, 0xf6, 0x00, 0x00, 0x04, 0x46, 0x05, 0xd5, 0x00, 0x0a, 0x00, 0x00,
+    0x25, 0x21, 0x11, 0x05, 0x35, 0x25, 0x33, 0x11, 0x21, 0x15, 0x21, 0x01, 0x0e, 0x01, 0x3a, 0xfe,
+    0xae, 0x01, 0x50, 0xca, 0x01, 0x36, 0xfc, 0xc8, 0xaa, 0x04, 0x75, 0x4c, 0xb8, 0x4a, 0xfa, 0xd5,
+    0xaa, 0x00, 0x00, 0x01, 0x00, 0x98, 0x00, 0x00, 0x04, 0x23, 0x05, 0xf0, 0x00, 0x1c, 0x00, 0x00,
+    0x25, 0x21, 0x15, 0x21, 0x35, 0x36, 0x00, 0x37, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
+    0x07, 0x35, 0x3e, 0x01, 0x33, 0x32, 0x04, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x01, 0x75, 0x02,
+    0xae, 0xfc, 0x75, 0xbb, 0x01, 0x18, 0x35, 0x64, 0x46, 0x93, 0x80, 0x5b, 0xc8, 0x70, 0x67, 0xc7,
+    0x61, 0xdb, 0x01, 0x0b, 0x59, 0x64, 0x38, 0xd5, 0xaa, 0xaa, 0xaa, 0xc5, 0x01, 0x2e, 0x3e, 0x7a,
+    0x97, 0x4f, 0x7d, 0x8e, 0x42, 0x43, 0xcc, 0x31, 0x32, 0xe9, 0xbd, 0x60, 0xc0, 0x74, 0x41, 0xe6,
+    0x00, 0x01, 0x00, 0x89, 0xff, 0xe3, 0x04, 0x37, 0x05, 0xf0, 0x00, 0x28, 0x00, 0x00, 0x01, 0x1e,
+    0x01, 0x15, 0x14, 0x04, 0x23, 0x22, 0x26, 0x27, 0x35, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x35, 0x34,
+    0x26, 0x2b, 0x01, 0x35, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x3e,
+    0x01, 0x33, 0x32, 0x04, 0x15, 0x14, 0x06, 0x03, 0x08, 0x93, 0x9c, 0xfe, 0xeb, 0xf5, 0x67, 0xd6,
+    0x67, 0x66, 0xc6, 0x62, 0xa6, 0xb2, 0xb2, 0x98, 0x9a, 0x9a, 0x8b, 0x9c, 0x91, 0x86, 0x59, 0xbe,
+    0x68, 0x79, 0xbd, 0x49, 0xda, 0x01, 0x05, 0x89, 0x03, 0x1f, 0x27, 0xc7, 0x95, 0xce, 0xeb, 0x26,
+    0x24, 0xc9, 0x35, 0x34, 0x96, 0x8d, 0x82, 0x99, 0xa6, 0x7a, 0x6d, 0x73, 0x7b, 0x28, 0x28, 0xba,
+    0x20, 0x20, 0xdb, 0xb5, 0x7b, 0xa4, 0x00, 0x02, 0x00, 0x66, 0x00, 0x00, 0x04, 0x6f, 0x05, 0xd5,
+    0x00, 0x02, 0x00, 0x0d, 0x00, 0x00, 0x09, 0x01, 0x21, 0x03, 0x33, 0x11, 0x33, 0x15, 0x23, 0x11,
+    0x23, 0x11, 0x21, 0x35, 0x02, 0xdf, 0xfe, 0x29, 0x01, 0xd7, 0x21, 0xea, 0xc7, 0xc7, 0xc9, 0xfd,
+    0x87, 0x05, 0x1d, 0xfc, 0xeb, 0x03, 0xcd, 0xfc, 0x33, 0xa4, 0xfe, 0x9c, 0x01, 0x64, 0xbf, 0x00,
+    0x00, 0x01, 0x00, 0x8f, 0xff, 0xe3, 0x04, 0x2d, 0x05, 0xd5, 0x00, 0x1d, 0x00, 0x00, 0x13, 0x21,
+    0x15, 0x21, 0x11, 0x3e, 0x01, 0x33, 0x32, 0x00, 0x15, 0x14, 0x00, 0x23, 0x22, 0x26, 0x27, 0x35,
+    0x1e, 0x01, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0xcf, 0x02, 0xf4, 0xfd,
+    0xc4, 0x2b, 0x57, 0x2c, 0xe8, 0x01, 0x10, 0xfe, 0xe3, 0xf7, 0x77, 0xc5, 0x4e, 0x5c, 0xba, 0x61,
+    0xa7, 0xb5, 0xbb, 0xa7, 0x51, 0x9a, 0x46, 0x05, 0xd5, 0xaa, 0xfe, 0x91, 0x10, 0x0f, 0xfe, 0xee,
+    0xea, 0xec, 0xfe, 0xf0, 0x20, 0x20, 0xcd, 0x32, 0x31, 0xb0, 0xa2, 0xa0, 0xb2, 0x25, 0x25, 0x00,
+    0x00, 0x02, 0x00, 0x85, 0xff, 0xe3, 0x04, 0x4c, 0x05, 0xf0, 0x00, 0x18, 0x00, 0x24, 0x00, 0x00,
+    0x01, 0x15, 0x2e, 0x01, 0x23, 0x22, 0x02, 0x11, 0x3e, 0x01, 0x33, 0x32, 0x12, 0x15, 0x14, 0x02,
+    0x23, 0x20, 0x02, 0x11, 0x10, 0x00, 0x21, 0x32, 0x16, 0x01, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33,
+    0x32, 0x36, 0x35, 0x34, 0x26, 0x03, 0xdf, 0x3f, 0x8e, 0x4d, 0xc0, 0xc6, 0x30, 0xaa, 0x6e, 0xd8,
+    0xed, 0xf4, 0xdd, 0xfe, 0xfc, 0xf2, 0x01, 0x23, 0x01, 0x14, 0x4a, 0x94, 0xfe, 0xdd, 0x81, 0x94,
+    0x94, 0x81, 0x86, 0x88, 0x88, 0x05, 0xb4, 0xba, 0x25, 0x27, 0xfe, 0xdf, 0xfe, 0xe7, 0x64, 0x6b,
+    0xfe, 0xf7, 0xf3, 0xf2, 0xfe, 0xf6, 0x01, 0x75, 0x01, 0x91, 0x01, 0x7a, 0x01, 0x8d, 0x1f, 0xfd,
+    0x6c, 0xba, 0xa4, 0xa4, 0xba, 0xb1, 0xad, 0xae, 0xb0, 0x00, 0x00, 0x01, 0x00, 0x8b, 0x00, 0x00,
+    0x04, 0x37, 0x05, 0xd5, 0x00, 0x06, 0x00, 0x00, 0x13, 0x21, 0x15, 0x01, 0x23, 0x01, 0x21, 0x8b,
+    0x03, 0xac, 0xfd, 0xea, 0xd3, 0x02, 0x08, 0xfd, 0x35, 0x05, 0xd5, 0x56, 0xfa, 0x81, 0x05, 0x2b,
+    0x00, 0x03, 0x00, 0x83, 0xff, 0xe3, 0x04, 0x4e, 0x05, 0xf0, 0x00, 0x0b, 0x00, 0x23, 0x00, 0x2f,
+    0x00, 0x00, 0x01, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x25, 0x2e,
+    0x01, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x1e, 0x01, 0x15, 0x14, 0x04,
+    0x23, 0x22, 0x24, 0x35, 0x34, 0x36, 0x13, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
+    0x22, 0x06, 0x02, 0x68, 0x87, 0x93, 0x95, 0x85, 0x88, 0x93, 0x95, 0xfe, 0xca, 0x81, 0x91, 0xf2,
+    0xd0, 0xd1, 0xf2, 0x91, 0x81, 0x96, 0x9f, 0xfe, 0xfe, 0xe4, 0xe4, 0xfe, 0xff, 0x9f, 0x4d, 0x80,
+    0x79, 0x7a, 0x80, 0x7f, 0x7b, 0x79, 0x80, 0x02, 0xc5, 0x97, 0x8a, 0x8a, 0x99, 0x97, 0x8c, 0x89,
+    0x98, 0x54, 0x21, 0xb4, 0x7f, 0xb2, 0xd1, 0xd1, 0xb2, 0x7f, 0xb4, 0x21, 0x21, 0xc8, 0x9f, 0xca,
+    0xe4, 0xe3, 0xc9, 0xa0, 0xc9, 0x01, 0x62, 0x78, 0x7e, 0x7e, 0x78, 0x7a, 0x80, 0x81, 0x00, 0x02,
+    0x00, 0x7f, 0xff, 0xe3, 0x04, 0x46, 0x05, 0xf0, 0x00, 0x0b, 0x00, 0x24, 0x00, 0x00, 0x01, 0x32,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x03, 0x35, 0x1e, 0x01, 0x33, 0x32,
+    0x12, 0x11, 0x0e, 0x01, 0x23, 0x22, 0x02, 0x35, 0x34, 0x12, 0x33, 0x20, 0x12, 0x11, 0x10, 0x00,
+    0x21, 0x22, 0x26, 0x02, 0x54, 0x81, 0x93, 0x93, 0x81, 0x86, 0x88, 0x87, 0xe1, 0x3f, 0x8e, 0x4d,
+    0xc0, 0xc5, 0x2f, 0xaa, 0x6e, 0xd8, 0xed, 0xf3, 0xde, 0x01, 0x04, 0xf2, 0xfe, 0xdd, 0xfe, 0xeb,
+    0x49, 0x94, 0x02, 0x96, 0xba, 0xa4, 0xa4, 0xba, 0xb1, 0xad, 0xae, 0xb0, 0xfd, 0x89, 0xba, 0x25,
+    0x27, 0x01, 0x21, 0x01, 0x19, 0x64, 0x6b, 0x01, 0x0a, 0xf4, 0xf1, 0x01, 0x09, 0xfe, 0x8a, 0xfe,
+    0x6f, 0xfe, 0x87, 0xfe, 0x73, 0x1f, 0x00, 0x02, 0x01, 0xe9, 0x00, 0x00, 0x02, 0xe5, 0x04, 0x27,
+    0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x33, 0x11, 0x23, 0x11, 0x33, 0x11, 0x23, 0x01, 0xe9,
+    0xfc, 0xfc, 0xfc, 0xfc, 0x04, 0x27, 0xfe, 0xd1, 0xfe, 0x39, 0xfe, 0xcf, 0x00, 0x02, 0x01, 0x93,
+    0xfe, 0xe1, 0x02, 0xf2, 0x04, 0x27, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x01, 0x33, 0x15, 0x03,
+    0x23, 0x13, 0x03, 0x33, 0x11, 0x23, 0x01, 0xf6, 0xfc, 0xc5, 0x9a, 0x63, 0x0d, 0xfc, 0xfc, 0x01,
+    0x2f, 0xcf, 0xfe, 0x81, 0x01, 0x7f, 0x03, 0xc7, 0xfe, 0xd1, 0x00, 0x01, 0x00, 0x58, 0x00, 0x8d,
+    0x04, 0x79, 0x04, 0x77, 0x00, 0x06, 0x00, 0x00, 0x09, 0x02, 0x15, 0x01, 0x35, 0x01, 0x04, 0x79,
+    0xfc, 0xae, 0x03, 0x52, 0xfb, 0xdf, 0x04, 0x21, 0x03, 0xc1, 0xfe, 0xc0, 0xfe, 0xc3, 0xb7, 0x01,
+    0xa2, 0xa6, 0x01, 0xa2, 0x00, 0x02, 0x00, 0x58, 0x01, 0x60, 0x04, 0x79, 0x03, 0xa2, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x00, 0x13, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x58, 0x04, 0x21, 0xfb,
+    0xdf, 0x04, 0x21, 0xfb, 0xdf, 0x02, 0x0c, 0xac, 0x02, 0x42, 0xaa, 0x00, 0x00, 0x01, 0x00, 0x58,
+    0x00, 0x8d, 0x04, 0x79, 0x04, 0x77, 0x00, 0x06, 0x00, 0x00, 0x13, 0x35, 0x01, 0x15, 0x01, 0x35,
+    0x01, 0x58, 0x04, 0x21, 0xfb, 0xdf, 0x03, 0x52, 0x03, 0xc1, 0xb6, 0xfe, 0x5e, 0xa6, 0xfe, 0x5e,
+    0xb7, 0x01, 0x3d, 0x00, 0x00, 0x02, 0x00, 0xf4, 0x00, 0x00, 0x04, 0x10, 0x05, 0xf0, 0x00, 0x1e,
+    0x00, 0x22, 0x00, 0x00, 0x01, 0x23, 0x35, 0x34, 0x36, 0x3f, 0x01, 0x3e, 0x01, 0x35, 0x34, 0x26,
+    0x23, 0x22, 0x06, 0x07, 0x35, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x0e,
+    0x01, 0x1d, 0x01, 0x03, 0x33, 0x15, 0x23, 0x02, 0xac, 0xbe, 0x3d, 0x54, 0x5a, 0x3e, 0x2f, 0x83,
+    0x6d, 0x4e, 0xb2, 0x62, 0x5e, 0xbf, 0x68, 0xba, 0xdd, 0x43, 0x5e, 0x58, 0x45, 0x26, 0xc5, 0xcb,
+    0xcb, 0x01, 0x91, 0x9a, 0x62, 0x89, 0x52, 0x59, 0x3b, 0x58, 0x31, 0x59, 0x6e, 0x45, 0x44, 0xbc,
+    0x39, 0x38, 0xc0, 0xa1, 0x4c, 0x83, 0x5c, 0x56, 0x42, 0x54, 0x3d, 0x2f, 0xfe, 0xf2, 0xfe, 0x00,
+    0x00, 0x02, 0x00, 0x1b, 0xfe, 0xc1, 0x04, 0x9a, 0x05, 0x73, 0x00, 0x0b, 0x00, 0x34, 0x00, 0x00,
+    0x01, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x13, 0x23, 0x35, 0x0e,
+    0x01, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x35, 0x34, 0x26, 0x23, 0x22,
+    0x00, 0x11, 0x10, 0x00, 0x21, 0x32, 0x36, 0x37, 0x17, 0x0e, 0x01, 0x23, 0x20, 0x00, 0x11, 0x10,
+    0x00, 0x21, 0x32, 0x12, 0x15, 0x04, 0x0e, 0x80, 0x6b, 0x6b, 0x81, 0x81, 0x6b, 0x6b, 0x80, 0x8c,
+    0x90, 0x25, 0x83, 0x52, 0xa1, 0xd3, 0xd3, 0xa1, 0x50, 0x86, 0x24, 0xb0, 0x91, 0xf6, 0xfe, 0xdd,
+    0x01, 0x4a, 0x01, 0x12, 0x36, 0x6c, 0x39, 0x30, 0x3f, 0x7b, 0x3a, 0xfe, 0x9b, 0xfe, 0x5d, 0x01,
+    0x78, 0x01, 0x3c, 0xd1, 0xfa, 0x02, 0x21, 0x81, 0x9b, 0x9b, 0x81, 0x82, 0x9b, 0x9b, 0xfe, 0xe8,
+    0x6f, 0x3f, 0x44, 0xf2, 0xbc, 0xbc, 0xf2, 0x46, 0x3d, 0x3f, 0x9c, 0xbe, 0xfe, 0x81, 0xfe, 0xb9,
+    0xfe, 0xb7, 0xfe, 0x7a, 0x14, 0x15, 0x87, 0x19, 0x18, 0x01, 0xd2, 0x01, 0x8c, 0x01, 0x86, 0x01,
+    0xce, 0xfe, 0xf6, 0xe0, 0x00, 0x02, 0x00, 0x25, 0x00, 0x00, 0x04, 0xac, 0x05, 0xd5, 0x00, 0x02,
+    0x00, 0x0a, 0x00, 0x00, 0x01, 0x03, 0x21, 0x01, 0x33, 0x01, 0x23, 0x03, 0x21, 0x03, 0x23, 0x02,
+    0x68, 0xd5, 0x01, 0xaa, 0xfe, 0xb1, 0xf5, 0x01, 0xc9, 0xd1, 0x6e, 0xfd, 0xf5, 0x6c, 0xd1, 0x05,
+    0x23, 0xfd, 0x04, 0x03, 0xae, 0xfa, 0x2b, 0x01, 0x85, 0xfe, 0x7b, 0x00, 0x00, 0x03, 0x00, 0xa6,
+    0x00, 0x00, 0x04, 0x71, 0x05, 0xd5, 0x00, 0x08, 0x00, 0x11, 0x00, 0x20, 0x00, 0x00, 0x01, 0x11,
+    0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x03, 0x11, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
+    0x25, 0x21, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x1e, 0x01, 0x15, 0x14, 0x04, 0x29, 0x01, 0x01,
+    0x71, 0xef, 0xb0, 0x96, 0x9e, 0xa8, 0xef, 0xeb, 0x92, 0x83, 0x81, 0x94, 0xfe, 0x4a, 0x01, 0xba,
+    0xe5, 0xf8, 0x83, 0x83, 0x93, 0xa7, 0xfe, 0xf6, 0xfe, 0xf9, 0xfe, 0x46, 0x02, 0xc9, 0xfd, 0xdd,
+    0x7b, 0x8d, 0x92, 0x89, 0x02, 0x66, 0xfe, 0x3e, 0x70, 0x7d, 0x71, 0x64, 0xa6, 0xc6, 0xb5, 0x89,
+    0x9e, 0x14, 0x16, 0xcf, 0xa0, 0xcb, 0xcf, 0x00, 0x00, 0x01, 0x00, 0x8b, 0xff, 0xe3, 0x04, 0x31,
+    0x05, 0xf0, 0x00, 0x19, 0x00, 0x00, 0x25, 0x0e, 0x01, 0x23, 0x20, 0x00, 0x11, 0x10, 0x00, 0x21,
+    0x32, 0x16, 0x17, 0x15, 0x2e, 0x01, 0x23, 0x22, 0x02, 0x11, 0x10, 0x12, 0x33, 0x32, 0x36, 0x37,
+    0x04, 0x31, 0x4d, 0xa2, 0x5b, 0xfe, 0xe1, 0xfe, 0xc3, 0x01, 0x3f, 0x01, 0x1d, 0x5b, 0xa2, 0x4d,
+    0x4a, 0xaa, 0x56, 0xc5, 0xc4, 0xc4, 0xc5, 0x58, 0xa9, 0x49, 0x35, 0x29, 0x29, 0x01, 0x96, 0x01,
+    0x70, 0x01, 0x6e, 0x01, 0x99, 0x29, 0x29, 0xcf, 0x3d, 0x40, 0xfe, 0xd0, 0xfe, 0xcd, 0xfe, 0xce,
+    0xfe, 0xd0, 0x40, 0x3d, 0x00, 0x02, 0x00, 0x89, 0x00, 0x00, 0x04, 0x52, 0x05, 0xd5, 0x00, 0x08,
+    0x00, 0x11, 0x00, 0x00, 0x25, 0x20, 0x36, 0x11, 0x10, 0x26, 0x21, 0x23, 0x11, 0x13, 0x20, 0x00,
+    0x11, 0x10, 0x00, 0x29, 0x01, 0x11, 0x01, 0xb4, 0x00, 0xff, 0xca, 0xc9, 0xff, 0x00, 0x60, 0x64,
+    0x01, 0x56, 0x01, 0x44, 0xfe, 0xbc, 0xfe, 0xaa, 0xfe, 0xd1, 0xa6, 0xfb, 0x01, 0x48, 0x01, 0x4b,
+    0xfb, 0xfb, 0x77, 0x05, 0x2f, 0xfe, 0x94, 0xfe, 0x80, 0xfe, 0x82, 0xfe, 0x95, 0x05, 0xd5, 0x00,
+    0x00, 0x01, 0x00, 0xc5, 0x00, 0x00, 0x04, 0x4e, 0x05, 0xd5, 0x00, 0x0b, 0x00, 0x00, 0x13, 0x21,
+    0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0xc5, 0x03, 0x76, 0xfd, 0x54, 0x02,
+    0x8e, 0xfd, 0x72, 0x02, 0xbf, 0xfc, 0x77, 0x05, 0xd5, 0xaa, 0xfe, 0x46, 0xaa, 0xfd, 0xe3, 0xaa,
+    0x00, 0x01, 0x00, 0xe9, 0x00, 0x00, 0x04, 0x58, 0x05, 0xd5, 0x00, 0x09, 0x00, 0x00, 0x13, 0x21,
+    0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x23, 0xe9, 0x03, 0x6f, 0xfd, 0x5c, 0x02, 0x65, 0xfd,
+    0x9b, 0xcb, 0x05, 0xd5, 0xaa, 0xfe, 0x48, 0xaa, 0xfd, 0x37, 0x00, 0x01, 0x00, 0x66, 0xff, 0xe3,
+    0x04, 0x50, 0x05, 0xf0, 0x00, 0x1d, 0x00, 0x00, 0x25, 0x0e, 0x01, 0x23, 0x20, 0x00, 0x11, 0x10,
+    0x00, 0x21, 0x32, 0x16, 0x17, 0x15, 0x2e, 0x01, 0x23, 0x22, 0x02, 0x11, 0x10, 0x12, 0x33, 0x32,
+    0x36, 0x37, 0x11, 0x23, 0x35, 0x21, 0x04, 0x50, 0x51, 0xcb, 0x76, 0xfe, 0xe4, 0xfe, 0xc4, 0x01,
+    0x40, 0x01, 0x1d, 0x5e, 0xac, 0x50, 0x51, 0xaa, 0x5f, 0xc5, 0xc5, 0xbf, 0xc6, 0x43, 0x65, 0x29,
+    0xd9, 0x01, 0x9a, 0x7b, 0x4b, 0x4d, 0x01, 0x97, 0x01, 0x6f, 0x01, 0x6e, 0x01, 0x99, 0x35, 0x36,
+    0xcf, 0x4d, 0x49, 0xfe, 0xcf, 0xfe, 0xce, 0xfe, 0xc9, 0xfe, 0xd5, 0x1f, 0x21, 0x01, 0x91, 0xa6,
+    0x00, 0x01, 0x00, 0x89, 0x00, 0x00, 0x04, 0x48, 0x05, 0xd5, 0x00, 0x0b, 0x00, 0x00, 0x13, 0x33,
+    0x11, 0x21, 0x11, 0x33, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x89, 0xcb, 0x02, 0x29, 0xcb, 0xcb,
+    0xfd, 0xd7, 0xcb, 0x05, 0xd5, 0xfd, 0x9c, 0x02, 0x64, 0xfa, 0x2b, 0x02, 0xc7, 0xfd, 0x39, 0x00,
+    0x00, 0x01, 0x00, 0xc9, 0x00, 0x00, 0x04, 0x06, 0x05, 0xd5, 0x00, 0x0b, 0x00, 0x00, 0x13, 0x21,
+    0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0xc9, 0x03, 0x3d, 0xfe, 0xc7, 0x01,
+    0x39, 0xfc, 0xc3, 0x01, 0x39, 0xfe, 0xc7, 0x05, 0xd5, 0xaa, 0xfb, 0x7f, 0xaa, 0xaa, 0x04, 0x81,
+    0x00, 0x01, 0x00, 0x6d, 0xff, 0xe3, 0x03, 0xbc, 0x05, 0xd5, 0x00, 0x11, 0x00, 0x00, 0x37, 0x35,
+    0x1e, 0x01, 0x33, 0x32, 0x36, 0x35, 0x11, 0x21, 0x35, 0x21, 0x11, 0x10, 0x06, 0x23, 0x22, 0x26,
+    0x6d, 0x5b, 0xc2, 0x68, 0x8f, 0x71, 0xfe, 0x83, 0x02, 0x47, 0xd3, 0xf7, 0x60, 0xbe, 0x3d, 0xec,
+    0x51, 0x51, 0x95, 0xcb, 0x03, 0x44, 0xaa, 0xfc, 0x12, 0xfe, 0xe6, 0xea, 0x2c, 0x00, 0x00, 0x01,
+    0x00, 0x89, 0x00, 0x00, 0x04, 0xc9, 0x05, 0xd5, 0x00, 0x0b, 0x00, 0x00, 0x13, 0x33, 0x11, 0x01,
+    0x33, 0x09, 0x01, 0x23, 0x01, 0x07, 0x11, 0x23, 0x89, 0xcb, 0x02, 0x77, 0xed, 0xfd, 0xbb, 0x02,
+    0x56, 0xf4, 0xfe, 0x19, 0x9a, 0xcb, 0x05, 0xd5, 0xfd, 0x68, 0x02, 0x98, 0xfd, 0x9e, 0xfc, 0x8d,
+    0x02, 0xec, 0xa4, 0xfd, 0xb8, 0x00, 0x00, 0x01, 0x00, 0xd7, 0x00, 0x00, 0x04, 0x73, 0x05, 0xd5,
+    0x00, 0x05, 0x00, 0x00, 0x13, 0x33, 0x11, 0x21, 0x15, 0x21, 0xd7, 0xcb, 0x02, 0xd1, 0xfc, 0x64,
+    0x05, 0xd5, 0xfa, 0xd5, 0xaa, 0x00, 0x00, 0x01, 0x00, 0x56, 0x00, 0x00, 0x04, 0x79, 0x05, 0xd5,
+    0x00, 0x0c, 0x00, 0x00, 0x13, 0x21, 0x09, 0x01, 0x21, 0x11, 0x23, 0x11, 0x01, 0x23, 0x01, 0x11,
+    0x23, 0x56, 0x01, 0x0e, 0x01, 0x02, 0x01, 0x04, 0x01, 0x0f, 0xbb, 0xfe, 0xf6, 0x99, 0xfe, 0xf5,
+    0xba, 0x05, 0xd5, 0xfd, 0x08, 0x02, 0xf8, 0xfa, 0x2b, 0x05, 0x27, 0xfc, 0xed, 0x03, 0x13, 0xfa,
+    0xd9, 0x00, 0x00, 0x01, 0x00, 0x8b, 0x00, 0x00, 0x04, 0x46, 0x05, 0xd5, 0x00, 0x09, 0x00, 0x00,
+    0x13, 0x21, 0x01, 0x11, 0x33, 0x11, 0x21, 0x01, 0x11, 0x23, 0x8b, 0x01, 0x00, 0x01, 0xf8, 0xc3,
+    0xff, 0x00, 0xfe, 0x08, 0xc3, 0x05, 0xd5, 0xfb, 0x33, 0x04, 0xcd, 0xfa, 0x2b, 0x04, 0xcd, 0xfb,
+    0x33, 0x00, 0x00, 0x02, 0x00, 0x75, 0xff, 0xe3, 0x04, 0x5c, 0x05, 0xf0, 0x00, 0x0b, 0x00, 0x17,
+    0x00, 0x00, 0x01, 0x10, 0x02, 0x23, 0x22, 0x02, 0x11, 0x10, 0x12, 0x33, 0x32, 0x12, 0x13, 0x10,
+    0x02, 0x23, 0x22, 0x02, 0x11, 0x10, 0x12, 0x33, 0x32, 0x12, 0x03, 0x89, 0x87, 0x9a, 0x99, 0x87,
+    0x87, 0x99, 0x9a, 0x87, 0xd3, 0xf7, 0xfd, 0xfd, 0xf6, 0xf7, 0xfc, 0xfd, 0xf7, 0x02, 0xe9, 0x01,
+    0x49, 0x01, 0x1a, 0xfe, 0xe6, 0xfe, 0xb7, 0xfe, 0xb8, 0xfe, 0xe6, 0x01, 0x19, 0x01, 0x49, 0xfe,
+    0x7a, 0xfe, 0x80, 0x01, 0x7e, 0x01, 0x88, 0x01, 0x87, 0x01, 0x80, 0xfe, 0x80, 0x00, 0x00, 0x02,
+    0x00, 0xc5, 0x00, 0x00, 0x04, 0x75, 0x05, 0xd5, 0x00, 0x08, 0x00, 0x13, 0x00, 0x00, 0x01, 0x11,
+    0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x25, 0x21, 0x32, 0x04, 0x15, 0x14, 0x04, 0x2b, 0x01,
+    0x11, 0x23, 0x01, 0x8f, 0xea, 0x8c, 0x9d, 0x9c, 0x8d, 0xfe, 0x4c, 0x01, 0xb4, 0xfa, 0x01, 0x02,
+    0xfe, 0xff, 0xfb, 0xea, 0xca, 0x05, 0x2f, 0xfd, 0xcf, 0x94, 0x85, 0x85, 0x93, 0xa6, 0xe3, 0xdb,
+    0xdd, 0xe2, 0xfd, 0xa8, 0x00, 0x02, 0x00, 0x75, 0xfe, 0xf2, 0x04, 0x5c, 0x05, 0xf0, 0x00, 0x11,
+    0x00, 0x1d, 0x00, 0x00, 0x05, 0x22, 0x06, 0x23, 0x22, 0x02, 0x11, 0x10, 0x12, 0x33, 0x32, 0x12,
+    0x11, 0x10, 0x02, 0x07, 0x17, 0x07, 0x13, 0x10, 0x02, 0x23, 0x22, 0x02, 0x11, 0x10, 0x12, 0x33,
+    0x32, 0x12, 0x02, 0x8f, 0x07, 0x1a, 0x08, 0xfa, 0xf7, 0xf7, 0xfc, 0xfd, 0xf7, 0x89, 0x8b, 0xc8,
+    0x97, 0x10, 0x87, 0x9a, 0x99, 0x87, 0x87, 0x99, 0x9a, 0x87, 0x1b, 0x02, 0x01, 0x80, 0x01, 0x86,
+    0x01, 0x87, 0x01, 0x80, 0xfe, 0x80, 0xfe, 0x79, 0xfe, 0xda, 0xfe, 0x99, 0x48, 0xbe, 0x64, 0x03,
+    0xf7, 0x01, 0x49, 0x01, 0x1a, 0xfe, 0xe6, 0xfe, 0xb7, 0xfe, 0xb8, 0xfe, 0xe6, 0x01, 0x19, 0x00,
+    0x00, 0x02, 0x00, 0x8f, 0x00, 0x00, 0x04, 0xd1, 0x05, 0xd5, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x00,
+    0x01, 0x1e, 0x01, 0x17, 0x13, 0x23, 0x03, 0x2e, 0x01, 0x2b, 0x01, 0x11, 0x23, 0x11, 0x21, 0x32,
+    0x04, 0x15, 0x14, 0x06, 0x01, 0x11, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x02, 0xf8, 0x4e,
+    0x6e, 0x52, 0xcb, 0xd9, 0xb2, 0x4d, 0x7b, 0x63, 0xc1, 0xcb, 0x01, 0xa0, 0xf6, 0x01, 0x06, 0xa1,
+    0xfd, 0xd0, 0xdd, 0x91, 0x8e, 0x97, 0x90, 0x02, 0xc1, 0x14, 0x6f, 0xa6, 0xfe, 0x68, 0x01, 0x79,
+    0xa1, 0x5d, 0xfd, 0x89, 0x05, 0xd5, 0xde, 0xd2, 0x94, 0xbb, 0x02, 0x59, 0xfd, 0xee, 0x82, 0x86,
+    0x81, 0x89, 0x00, 0x01, 0x00, 0x8b, 0xff, 0xe3, 0x04, 0x4a, 0x05, 0xf0, 0x00, 0x27, 0x00, 0x00,
+    0x01, 0x15, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x1f, 0x01, 0x1e, 0x01, 0x15, 0x14,
+    0x04, 0x23, 0x22, 0x26, 0x27, 0x35, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x2f, 0x01,
+    0x2e, 0x01, 0x35, 0x34, 0x24, 0x33, 0x32, 0x16, 0x03, 0xf4, 0x5c, 0xb9, 0x5e, 0x8f, 0xa6, 0x6d,
+    0x95, 0x6a, 0xd2, 0xc0, 0xfe, 0xf8, 0xfc, 0x69, 0xd4, 0x6b, 0x73, 0xcd, 0x68, 0x99, 0xaa, 0x75,
+    0x91, 0x6c, 0xd0, 0xbc, 0x01, 0x0d, 0xdf, 0x56, 0xbe, 0x05, 0xa2, 0xcd, 0x3b, 0x3c, 0x85, 0x71,
+    0x63, 0x68, 0x23, 0x18, 0x31, 0xd2, 0xb5, 0xd5, 0xe0, 0x2d, 0x2d, 0xd7, 0x49, 0x44, 0x89, 0x7b,
+    0x70, 0x76, 0x20, 0x19, 0x2f, 0xbe, 0xa0, 0xc8, 0xf1, 0x27, 0x00, 0x01, 0x00, 0x2f, 0x00, 0x00,
+    0x04, 0xa2, 0x05, 0xd5, 0x00, 0x07, 0x00, 0x00, 0x13, 0x21, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21,
+    0x2f, 0x04, 0x73, 0xfe, 0x2d, 0xcb, 0xfe, 0x2b, 0x05, 0xd5, 0xaa, 0xfa, 0xd5, 0x05, 0x2b, 0x00,
+    0x00, 0x01, 0x00, 0x93, 0xff, 0xe3, 0x04, 0x3d, 0x05, 0xd5, 0x00, 0x1d, 0x00, 0x00, 0x13, 0x11,
+    0x33, 0x11, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x3e, 0x01, 0x35, 0x11, 0x33,
+    0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x93, 0xcb, 0x0c, 0x0f,
+    0x20, 0x79, 0x56, 0x57, 0x78, 0x21, 0x0f, 0x0c, 0xca, 0x39, 0x46, 0x42, 0xaa, 0x6a, 0x69, 0xaa,
+    0x43, 0x45, 0x3a, 0x02, 0x3d, 0x03, 0x98, 0xfc, 0x0c, 0x6d, 0x5d, 0x19, 0x3b, 0x3c, 0x3c, 0x3b,
+    0x19, 0x5c, 0x6c, 0x03, 0xf6, 0xfc, 0x68, 0xe5, 0xc1, 0x3f, 0x3b, 0x3a, 0x3a, 0x3b, 0x3e, 0xc5,
+    0x00, 0x01, 0x00, 0x39, 0x00, 0x00, 0x04, 0x98, 0x05, 0xd5, 0x00, 0x06, 0x00, 0x00, 0x25, 0x01,
+    0x33, 0x01, 0x23, 0x01, 0x33, 0x02, 0x68, 0x01, 0x5f, 0xd1, 0xfe, 0x4b, 0xf5, 0xfe, 0x4b, 0xd1,
+    0xaa, 0x05, 0x2b, 0xfa, 0x2b, 0x05, 0xd5, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1,
+    0x05, 0xd5, 0x00, 0x0c, 0x00, 0x00, 0x11, 0x33, 0x1b, 0x01, 0x33, 0x1b, 0x01, 0x33, 0x03, 0x23,
+    0x0b, 0x01, 0x23, 0xc5, 0x8f, 0xaa, 0xd3, 0xac, 0x8f, 0xc5, 0xdf, 0xbf, 0xcb, 0xca, 0xbf, 0x05,
+    0xd5, 0xfb, 0x44, 0x03, 0x22, 0xfc, 0xdc, 0x04, 0xbe, 0xfa, 0x2b, 0x03, 0x77, 0xfc, 0x89, 0x00,
+    0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x04, 0xbe, 0x05, 0xd5, 0x00, 0x0b, 0x00, 0x00, 0x13, 0x33,
+    0x09, 0x01, 0x33, 0x09, 0x01, 0x23, 0x09, 0x01, 0x23, 0x01, 0x56, 0xd9, 0x01, 0x48, 0x01, 0x4e,
+    0xd9, 0xfe, 0x41, 0x01, 0xdf, 0xd9, 0xfe, 0x92, 0xfe, 0x75, 0xda, 0x01, 0xf4, 0x05, 0xd5, 0xfd,
+    0xcd, 0x02, 0x33, 0xfd, 0x42, 0xfc, 0xe9, 0x02, 0x83, 0xfd, 0x7d, 0x03, 0x17, 0x00, 0x00, 0x01,
+    0x00, 0x25, 0x00, 0x00, 0x04, 0xac, 0x05, 0xd5, 0x00, 0x08, 0x00, 0x00, 0x13, 0x33, 0x09, 0x01,
+    0x33, 0x01, 0x11, 0x23, 0x11, 0x25, 0xd7, 0x01, 0x6c, 0x01, 0x6b, 0xd9, 0xfe, 0x21, 0xcb, 0x05,
+    0xd5, 0xfd, 0x6d, 0x02, 0x93, 0xfc, 0xc9, 0xfd, 0x62, 0x02, 0x9e, 0x00, 0x00, 0x01, 0x00, 0x9c,
+    0x00, 0x00, 0x04, 0x91, 0x05, 0xd5, 0x00, 0x09, 0x00, 0x00, 0x13, 0x21, 0x15, 0x01, 0x21, 0x15,
+    0x21, 0x35, 0x01, 0x21, 0xb2, 0x03, 0xc9, 0xfc, 0xf4, 0x03, 0x22, 0xfc, 0x0b, 0x02, 0xf7, 0xfd,
+    0x1f, 0x05, 0xd5, 0x9a, 0xfb, 0x6f, 0xaa, 0x9a, 0x04, 0x91, 0x00, 0x01, 0x01, 0xcf, 0xfe, 0xf2,
+    0x03, 0x77, 0x06, 0x14, 0x00, 0x07, 0x00, 0x00, 0x01, 0x21, 0x15, 0x23, 0x11, 0x33, 0x15, 0x21,
+    0x01, 0xcf, 0x01, 0xa8, 0xf0, 0xf0, 0xfe, 0x58, 0x06, 0x14, 0x8f, 0xf9, 0xfc, 0x8f, 0x00, 0x01,
+    0x00, 0x66, 0xff, 0x42, 0x04, 0x37, 0x05, 0xd5, 0x00, 0x03, 0x00, 0x00, 0x09, 0x01, 0x23, 0x01,
+    0x01, 0x25, 0x03, 0x12, 0xbe, 0xfc, 0xed, 0x05, 0xd5, 0xf9, 0x6d, 0x06, 0x93, 0x00, 0x00, 0x01,
+    0x01, 0x5a, 0xfe, 0xf2, 0x03, 0x02, 0x06, 0x14, 0x00, 0x07, 0x00, 0x00, 0x01, 0x11, 0x21, 0x35,
+    0x33, 0x11, 0x23, 0x35, 0x03, 0x02, 0xfe, 0x58, 0xf0, 0xf0, 0x06, 0x14, 0xf8, 0xde, 0x8f, 0x06,
+    0x04, 0x8f, 0x00, 0x01, 0x00, 0x48, 0x03, 0xa8, 0x04, 0x89, 0x05, 0xd5, 0x00, 0x06, 0x00, 0x00,
+    0x09, 0x01, 0x23, 0x09, 0x01, 0x23, 0x01, 0x02, 0xc1, 0x01, 0xc8, 0xb2, 0xfe, 0x91, 0xfe, 0x92,
+    0xb2, 0x01, 0xc8, 0x05, 0xd5, 0xfd, 0xd3, 0x01, 0x8b, 0xfe, 0x75, 0x02, 0x2d, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0xfe, 0x1d, 0x04, 0xd1, 0xfe, 0x6d, 0x00, 0x03, 0x00, 0x00, 0x01, 0x15, 0x21, 0x35,
+    0x04, 0xd1, 0xfb, 0x2f, 0xfe, 0x6d, 0x50, 0x50, 0x00, 0x01, 0x01, 0x17, 0x04, 0xee, 0x02, 0xf6,
+    0x06, 0x66, 0x00, 0x03, 0x00, 0x00, 0x09, 0x01, 0x23, 0x01, 0x01, 0xdd, 0x01, 0x19, 0x9a, 0xfe,
+    0xbb, 0x06, 0x66, 0xfe, 0x88, 0x01, 0x78, 0x00, 0x00, 0x02, 0x00, 0x85, 0xff, 0xe3, 0x04, 0x23,
+    0x04, 0x7b, 0x00, 0x0b, 0x00, 0x29, 0x00, 0x00, 0x01, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33,
+    0x32, 0x36, 0x37, 0x35, 0x37, 0x11, 0x23, 0x35, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36,
+    0x3b, 0x01, 0x35, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x07, 0x35, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17,
+    0x1e, 0x01, 0x02, 0xbe, 0x3d, 0xa1, 0xa3, 0x7a, 0x6c, 0x98, 0xae, 0x01, 0xb9, 0xb9, 0x3b, 0xb3,
+    0x80, 0xab, 0xcc, 0xfb, 0xf3, 0xf7, 0x01, 0x86, 0x93, 0x5e, 0xc0, 0x5b, 0x66, 0xbb, 0x58, 0x8b,
+    0xc5, 0x3d, 0x26, 0x20, 0x02, 0x33, 0x71, 0x70, 0x65, 0x70, 0xd3, 0xba, 0x29, 0x4c, 0xfd, 0x81,
+    0xa6, 0x64, 0x5f, 0xc1, 0xa2, 0xbb, 0xc2, 0x1d, 0x86, 0x79, 0x36, 0x34, 0xb8, 0x27, 0x27, 0x52,
+    0x52, 0x32, 0x93, 0x00, 0x00, 0x02, 0x00, 0xc1, 0xff, 0xe3, 0x04, 0x58, 0x06, 0x14, 0x00, 0x0b,
+    0x00, 0x1c, 0x00, 0x00, 0x01, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36,
+    0x01, 0x3e, 0x01, 0x33, 0x32, 0x12, 0x11, 0x10, 0x02, 0x23, 0x22, 0x26, 0x27, 0x15, 0x23, 0x11,
+    0x33, 0x03, 0x96, 0x88, 0x85, 0x86, 0x8a, 0x8a, 0x86, 0x85, 0x88, 0xfd, 0xe3, 0x2c, 0x9b, 0x66,
+    0xca, 0xe8, 0xe9, 0xcb, 0x64, 0x99, 0x2e, 0xb8, 0xb8, 0x02, 0x2f, 0xd6, 0xda, 0xdb, 0xd5, 0xd4,
+    0xdc, 0xda, 0x02, 0x78, 0x52, 0x58, 0xfe, 0xc9, 0xfe, 0xef, 0xfe, 0xeb, 0xfe, 0xc5, 0x57, 0x53,
+    0x8d, 0x06, 0x14, 0x00, 0x00, 0x01, 0x00, 0xc3, 0xff, 0xe3, 0x04, 0x25, 0x04, 0x7b, 0x00, 0x19,
+    0x00, 0x00, 0x25, 0x0e, 0x01, 0x23, 0x20, 0x00, 0x11, 0x10, 0x00, 0x21, 0x32, 0x16, 0x17, 0x15,
+    0x2e, 0x01, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x04, 0x25, 0x4a, 0x9d,
+    0x52, 0xfe, 0xfc, 0xfe, 0xdb, 0x01, 0x25, 0x01, 0x04, 0x51, 0x9a, 0x4e, 0x49, 0x93, 0x5d, 0xad,
+    0xba, 0xbb, 0xac, 0x60, 0x98, 0x41, 0x39, 0x2b, 0x2b, 0x01, 0x38, 0x01, 0x14, 0x01, 0x14, 0x01,
+    0x38, 0x2a, 0x2c, 0xc1, 0x41, 0x3a, 0xe0, 0xd0, 0xcf, 0xe1, 0x3b, 0x3e, 0x00, 0x02, 0x00, 0x7b,
+    0xff, 0xe3, 0x04, 0x12, 0x06, 0x14, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x00, 0x01, 0x11, 0x33, 0x11,
+    0x23, 0x35, 0x0e, 0x01, 0x23, 0x22, 0x02, 0x11, 0x10, 0x12, 0x33, 0x32, 0x16, 0x01, 0x14, 0x16,
+    0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x03, 0x5a, 0xb8, 0xb8, 0x2e, 0x99, 0x64,
+    0xcb, 0xe9, 0xea, 0xca, 0x65, 0x9a, 0xfe, 0x0f, 0x88, 0x85, 0x85, 0x8b, 0x8b, 0x85, 0x85, 0x88,
+    0x03, 0xd1, 0x02, 0x43, 0xf9, 0xec, 0x8d, 0x53, 0x57, 0x01, 0x3b, 0x01, 0x15, 0x01, 0x11, 0x01,
+    0x37, 0x57, 0xfe, 0x0b, 0xd6, 0xda, 0xdc, 0xd4, 0xd5, 0xdb, 0xda, 0x00, 0x00, 0x02, 0x00, 0x7b,
+    0xff, 0xe3, 0x04, 0x58, 0x04, 0x7b, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x00, 0x01, 0x15, 0x21, 0x15,
+    0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x0e, 0x01, 0x23, 0x20, 0x00, 0x11, 0x10, 0x00, 0x33,
+    0x32, 0x12, 0x07, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x07, 0x04, 0x58, 0xfc, 0xe3, 0xbf, 0xae, 0x58,
+    0xc0, 0x6d, 0x69, 0xc3, 0x5b, 0xfe, 0xfb, 0xfe, 0xda, 0x01, 0x20, 0xf0, 0xd6, 0xf7, 0xb8, 0x04,
+    0x91, 0x88, 0x85, 0xac, 0x10, 0x02, 0x5e, 0x5a, 0x06, 0xb7, 0xc8, 0x38, 0x39, 0xb7, 0x2b, 0x2b,
+    0x01, 0x39, 0x01, 0x13, 0x01, 0x0c, 0x01, 0x40, 0xfe, 0xde, 0xc5, 0xa2, 0xa9, 0xb0, 0x9c, 0x00,
+    0x00, 0x01, 0x00, 0xc3, 0x00, 0x00, 0x04, 0x27, 0x06, 0x14, 0x00, 0x13, 0x00, 0x00, 0x01, 0x15,
+    0x23, 0x22, 0x06, 0x1d, 0x01, 0x21, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21, 0x35, 0x21, 0x35, 0x34,
+    0x36, 0x33, 0x04, 0x27, 0xd1, 0x63, 0x4d, 0x01, 0x81, 0xfe, 0x7f, 0xb8, 0xfe, 0xd5, 0x01, 0x2b,
+    0xa9, 0xb3, 0x06, 0x14, 0x99, 0x51, 0x67, 0x63, 0x8f, 0xfc, 0x2f, 0x03, 0xd1, 0x8f, 0x4e, 0xb8,
+    0xae, 0x00, 0x00, 0x02, 0x00, 0x7b, 0xfe, 0x48, 0x04, 0x12, 0x04, 0x7b, 0x00, 0x0b, 0x00, 0x29,
+    0x00, 0x00, 0x01, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x13, 0x14,
+    0x02, 0x23, 0x22, 0x26, 0x27, 0x35, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x3d, 0x02, 0x0e, 0x01, 0x23,
+    0x22, 0x02, 0x11, 0x10, 0x12, 0x33, 0x32, 0x16, 0x17, 0x35, 0x33, 0x03, 0x5a, 0x87, 0x81, 0x87,
+    0x8e, 0x8f, 0x88, 0x7f, 0x87, 0xb8, 0xee, 0xe7, 0x4c, 0xa6, 0x53, 0x62, 0xa0, 0x43, 0x95, 0x88,
+    0x2c, 0x98, 0x6d, 0xc4, 0xea, 0xea, 0xc4, 0x6c, 0x96, 0x2f, 0xb8, 0x02, 0x39, 0xcf, 0xd7, 0xd7,
+    0xcf, 0xcf, 0xd9, 0xda, 0xfe, 0xdd, 0xfc, 0xfe, 0xfc, 0x1c, 0x1b, 0xb6, 0x2e, 0x2c, 0xa2, 0xb0,
+    0x08, 0x7d, 0x5e, 0x5c, 0x01, 0x3a, 0x01, 0x07, 0x01, 0x08, 0x01, 0x3a, 0x56, 0x5a, 0x91, 0x00,
+    0x00, 0x01, 0x00, 0xc3, 0x00, 0x00, 0x04, 0x1b, 0x06, 0x14, 0x00, 0x13, 0x00, 0x00, 0x01, 0x11,
+    0x23, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11, 0x23, 0x11, 0x33, 0x11, 0x3e, 0x01, 0x33,
+    0x32, 0x16, 0x04, 0x1b, 0xb9, 0x6a, 0x71, 0x81, 0x8b, 0xb8, 0xb8, 0x31, 0xa8, 0x73, 0xab, 0xa9,
+    0x02, 0xb6, 0xfd, 0x4a, 0x02, 0xb6, 0x97, 0x8e, 0xb7, 0xab, 0xfd, 0x87, 0x06, 0x14, 0xfd, 0xa4,
+    0x60, 0x63, 0xe1, 0x00, 0x00, 0x02, 0x00, 0xb2, 0x00, 0x00, 0x04, 0x44, 0x06, 0x14, 0x00, 0x09,
+    0x00, 0x0d, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35, 0x21, 0x11, 0x21, 0x01, 0x33,
+    0x15, 0x23, 0x01, 0x00, 0x01, 0xd7, 0x01, 0x6d, 0xfc, 0x6e, 0x01, 0x6d, 0xfe, 0xe1, 0x01, 0x1f,
+    0xb8, 0xb8, 0x04, 0x60, 0xfc, 0x2f, 0x8f, 0x8f, 0x03, 0x42, 0x02, 0x43, 0xe9, 0x00, 0x00, 0x02,
+    0x00, 0xba, 0xfe, 0x56, 0x03, 0x10, 0x06, 0x14, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x00, 0x05, 0x11,
+    0x21, 0x35, 0x21, 0x11, 0x14, 0x06, 0x2b, 0x01, 0x35, 0x33, 0x32, 0x36, 0x11, 0x33, 0x15, 0x23,
+    0x02, 0x58, 0xfe, 0xc3, 0x01, 0xf5, 0xb3, 0xa5, 0xfe, 0xea, 0x5a, 0x5a, 0xb8, 0xb8, 0x14, 0x03,
+    0xe5, 0x8f, 0xfb, 0x8c, 0xc3, 0xd3, 0x9c, 0x7d, 0x06, 0xa5, 0xe9, 0x00, 0x00, 0x01, 0x00, 0xec,
+    0x00, 0x00, 0x04, 0xb2, 0x06, 0x14, 0x00, 0x0b, 0x00, 0x00, 0x13, 0x33, 0x11, 0x01, 0x33, 0x09,
+    0x01, 0x23, 0x01, 0x07, 0x11, 0x23, 0xec, 0xbe, 0x01, 0xe3, 0xe0, 0xfe, 0x47, 0x01, 0xfe, 0xe1,
+    0xfe, 0x62, 0x89, 0xbe, 0x06, 0x14, 0xfc, 0x7b, 0x01, 0xd1, 0xfe, 0x5a, 0xfd, 0x46, 0x02, 0x42,
+    0x81, 0xfe, 0x3f, 0x00, 0x00, 0x01, 0x00, 0xa0, 0x00, 0x00, 0x04, 0x0a, 0x06, 0x1f, 0x00, 0x0d,
+    0x00, 0x00, 0x01, 0x14, 0x16, 0x3b, 0x01, 0x15, 0x23, 0x22, 0x26, 0x35, 0x11, 0x21, 0x35, 0x21,
+    0x02, 0x7f, 0x5b, 0x59, 0xd7, 0xe9, 0xa5, 0xb5, 0xfe, 0xd9, 0x01, 0xdf, 0x01, 0x96, 0x7c, 0x7e,
+    0x9c, 0xd4, 0xc2, 0x03, 0xf9, 0x90, 0x00, 0x01, 0x00, 0x6d, 0x00, 0x00, 0x04, 0x6f, 0x04, 0x7b,
+    0x00, 0x22, 0x00, 0x00, 0x01, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x19, 0x01, 0x23, 0x11, 0x34, 0x26,
+    0x23, 0x22, 0x06, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11, 0x23, 0x11,
+    0x33, 0x15, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x02, 0xa4, 0x22, 0x69, 0x4a, 0x87, 0x6f, 0xa8, 0x35,
+    0x46, 0x50, 0x3b, 0xa8, 0x39, 0x4a, 0x49, 0x39, 0xa7, 0xa7, 0x21, 0x63, 0x3f, 0x4c, 0x65, 0x03,
+    0xee, 0x48, 0x45, 0xd1, 0xfe, 0xdf, 0xfd, 0x77, 0x02, 0x81, 0xed, 0x73, 0x7b, 0xe5, 0xfd, 0x7f,
+    0x02, 0x81, 0xf0, 0x70, 0x7b, 0xe5, 0xfd, 0x7f, 0x04, 0x60, 0x60, 0x3c, 0x3f, 0x46, 0x00, 0x01,
+    0x00, 0xc3, 0x00, 0x00, 0x04, 0x1b, 0x04, 0x7b, 0x00, 0x13, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11,
+    0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11, 0x23, 0x11, 0x33, 0x15, 0x3e, 0x01, 0x33, 0x32, 0x16,
+    0x04, 0x1b, 0xb9, 0x6a, 0x71, 0x81, 0x8b, 0xb8, 0xb8, 0x31, 0xa8, 0x73, 0xab, 0xa9, 0x02, 0xb6,
+    0xfd, 0x4a, 0x02, 0xb6, 0x97, 0x8e, 0xb7, 0xab, 0xfd, 0x87, 0x04, 0x60, 0xa8, 0x60, 0x63, 0xe1,
+    0x00, 0x02, 0x00, 0x89, 0xff, 0xe3, 0x04, 0x48, 0x04, 0x7b, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x00,
+    0x01, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x27, 0x32, 0x12, 0x11,
+    0x10, 0x02, 0x23, 0x22, 0x02, 0x11, 0x10, 0x12, 0x02, 0x68, 0x8c, 0x90, 0x90, 0x8c, 0x8d, 0x90,
+    0x90, 0x8d, 0xe9, 0xf7, 0xf6, 0xea, 0xe9, 0xf6, 0xf6, 0x03, 0xdf, 0xda, 0xd6, 0xd5, 0xdb, 0xdb,
+    0xd5, 0xd6, 0xda, 0x9c, 0xfe, 0xd2, 0xfe, 0xe2, 0xfe, 0xe1, 0xfe, 0xd3, 0x01, 0x2d, 0x01, 0x1f,
+    0x01, 0x1e, 0x01, 0x2e, 0x00, 0x02, 0x00, 0xbe, 0xfe, 0x56, 0x04, 0x54, 0x04, 0x7b, 0x00, 0x10,
+    0x00, 0x1c, 0x00, 0x00, 0x25, 0x11, 0x23, 0x11, 0x33, 0x15, 0x3e, 0x01, 0x33, 0x32, 0x12, 0x11,
+    0x10, 0x02, 0x23, 0x22, 0x26, 0x01, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32,
+    0x36, 0x01, 0x77, 0xb9, 0xb9, 0x2e, 0x99, 0x64, 0xcb, 0xe7, 0xe8, 0xca, 0x66, 0x99, 0x01, 0xf0,
+    0x87, 0x85, 0x86, 0x8a, 0x8a, 0x86, 0x85, 0x87, 0x8d, 0xfd, 0xc9, 0x06, 0x0a, 0x8f, 0x53, 0x57,
+    0xfe, 0xc6, 0xfe, 0xea, 0xfe, 0xef, 0xfe, 0xc9, 0x57, 0x01, 0xf5, 0xd6, 0xda, 0xdb, 0xd5, 0xd4,
+    0xdc, 0xda, 0x00, 0x02, 0x00, 0x89, 0xfe, 0x52, 0x04, 0x1f, 0x04, 0x77, 0x00, 0x0b, 0x00, 0x1c,
+    0x00, 0x00, 0x01, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x01, 0x0e,
+    0x01, 0x23, 0x22, 0x02, 0x11, 0x10, 0x12, 0x33, 0x32, 0x16, 0x17, 0x35, 0x33, 0x11, 0x23, 0x01,
+    0x4c, 0x87, 0x85, 0x85, 0x89, 0x89, 0x85, 0x85, 0x87, 0x02, 0x1a, 0x2d, 0x99, 0x65, 0xc9, 0xe9,
+    0xe8, 0xca, 0x64, 0x99, 0x2e, 0xb9, 0xb9, 0x02, 0x2b, 0xd6, 0xda, 0xdb, 0xd5, 0xd5, 0xdb, 0xda,
+    0xfd, 0x8a, 0x53, 0x59, 0x01, 0x37, 0x01, 0x11, 0x01, 0x16, 0x01, 0x3a, 0x57, 0x53, 0x8f, 0xf9,
+    0xf6, 0x00, 0x00, 0x01, 0x01, 0x6a, 0x00, 0x00, 0x04, 0x83, 0x04, 0x7b, 0x00, 0x11, 0x00, 0x00,
+    0x01, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x15, 0x11, 0x23, 0x11, 0x33, 0x15, 0x3e, 0x01, 0x33, 0x32,
+    0x16, 0x17, 0x04, 0x83, 0x3b, 0x7a, 0x49, 0xac, 0xb6, 0xb9, 0xb9, 0x2e, 0xbf, 0x83, 0x44, 0x76,
+    0x36, 0x03, 0x79, 0x2e, 0x2a, 0xd8, 0xcc, 0xfd, 0xd3, 0x04, 0x60, 0xdb, 0x77, 0x7f, 0x22, 0x24,
+    0x00, 0x01, 0x00, 0xd5, 0xff, 0xe3, 0x04, 0x06, 0x04, 0x7b, 0x00, 0x27, 0x00, 0x00, 0x01, 0x15,
+    0x2e, 0x01, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x1f, 0x01, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x23,
+    0x22, 0x26, 0x27, 0x35, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x35, 0x34, 0x2f, 0x02, 0x2e, 0x01, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x03, 0xcd, 0x4f, 0xa0, 0x53, 0x7d, 0x7b, 0x5c, 0xb7, 0x4a, 0x89,
+    0x8d, 0xec, 0xd2, 0x53, 0xb6, 0x6a, 0x67, 0xbc, 0x54, 0x7a, 0x86, 0xf5, 0x08, 0x45, 0x9f, 0x92,
+    0xda, 0xca, 0x5a, 0xa6, 0x04, 0x39, 0xb4, 0x2e, 0x2e, 0x51, 0x53, 0x4b, 0x4a, 0x23, 0x0e, 0x1a,
+    0x9c, 0x7d, 0xa6, 0xbb, 0x23, 0x23, 0xbe, 0x35, 0x35, 0x63, 0x59, 0x80, 0x31, 0x02, 0x0e, 0x1f,
+    0x93, 0x7f, 0xa1, 0xaf, 0x21, 0x00, 0x00, 0x01, 0x00, 0x83, 0x00, 0x00, 0x04, 0x08, 0x05, 0x9e,
+    0x00, 0x13, 0x00, 0x00, 0x01, 0x11, 0x21, 0x15, 0x21, 0x11, 0x14, 0x16, 0x3b, 0x01, 0x15, 0x23,
+    0x22, 0x26, 0x35, 0x11, 0x21, 0x35, 0x21, 0x11, 0x02, 0x66, 0x01, 0xa2, 0xfe, 0x5e, 0x5e, 0x75,
+    0xcf, 0xe1, 0xcf, 0xaa, 0xfe, 0xd5, 0x01, 0x2b, 0x05, 0x9e, 0xfe, 0xc2, 0x8f, 0xfd, 0xa0, 0x7c,
+    0x62, 0x93, 0xa6, 0xcb, 0x02, 0x60, 0x8f, 0x01, 0x3e, 0x00, 0x00, 0x01, 0x00, 0xc3, 0xff, 0xe3,
+    0x04, 0x1b, 0x04, 0x5e, 0x00, 0x13, 0x00, 0x00, 0x13, 0x11, 0x33, 0x11, 0x14, 0x16, 0x33, 0x32,
+    0x36, 0x35, 0x11, 0x33, 0x11, 0x23, 0x35, 0x0e, 0x01, 0x23, 0x22, 0x26, 0xc3, 0xb8, 0x6b, 0x70,
+    0x82, 0x8a, 0xb9, 0xb9, 0x31, 0xa9, 0x71, 0xac, 0xa8, 0x01, 0xa8, 0x02, 0xb6, 0xfd, 0x4a, 0x97,
+    0x8e, 0xb7, 0xab, 0x02, 0x79, 0xfb, 0xa2, 0xa8, 0x61, 0x64, 0xe1, 0x00, 0x00, 0x01, 0x00, 0x64,
+    0x00, 0x00, 0x04, 0x6d, 0x04, 0x60, 0x00, 0x06, 0x00, 0x00, 0x13, 0x33, 0x09, 0x01, 0x33, 0x01,
+    0x23, 0x64, 0xbf, 0x01, 0x45, 0x01, 0x46, 0xbf, 0xfe, 0x72, 0xed, 0x04, 0x60, 0xfc, 0x54, 0x03,
+    0xac, 0xfb, 0xa0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0x04, 0x60, 0x00, 0x0c,
+    0x00, 0x00, 0x11, 0x33, 0x1b, 0x01, 0x33, 0x1b, 0x01, 0x33, 0x01, 0x23, 0x0b, 0x01, 0x23, 0xb6,
+    0xc3, 0xa0, 0x9d, 0xa2, 0xc3, 0xb6, 0xfe, 0xfa, 0xb0, 0xb3, 0xb2, 0xb0, 0x04, 0x60, 0xfc, 0x77,
+    0x02, 0x42, 0xfd, 0xbe, 0x03, 0x89, 0xfb, 0xa0, 0x02, 0x66, 0xfd, 0x9a, 0x00, 0x01, 0x00, 0x4c,
+    0x00, 0x00, 0x04, 0x85, 0x04, 0x60, 0x00, 0x0b, 0x00, 0x00, 0x09, 0x02, 0x23, 0x09, 0x01, 0x23,
+    0x09, 0x01, 0x33, 0x09, 0x01, 0x04, 0x5e, 0xfe, 0x6f, 0x01, 0xb8, 0xd5, 0xfe, 0xb8, 0xfe, 0xb9,
+    0xd5, 0x01, 0xb8, 0xfe, 0x6f, 0xcc, 0x01, 0x29, 0x01, 0x27, 0x04, 0x60, 0xfd, 0xe8, 0xfd, 0xb8,
+    0x01, 0xc1, 0xfe, 0x3f, 0x02, 0x48, 0x02, 0x18, 0xfe, 0x6b, 0x01, 0x95, 0x00, 0x01, 0x00, 0x68,
+    0xfe, 0x56, 0x04, 0x81, 0x04, 0x60, 0x00, 0x12, 0x00, 0x00, 0x01, 0x06, 0x07, 0x02, 0x07, 0x0e,
+    0x01, 0x2b, 0x01, 0x35, 0x33, 0x32, 0x36, 0x37, 0x01, 0x33, 0x09, 0x01, 0x33, 0x03, 0x5a, 0x2e,
+    0x47, 0x63, 0x22, 0x2e, 0x8a, 0x5c, 0x94, 0x6d, 0x51, 0x5c, 0x47, 0xfe, 0x4f, 0xc3, 0x01, 0x4c,
+    0x01, 0x47, 0xc3, 0x01, 0x68, 0x75, 0xbf, 0xfe, 0xf8, 0x3a, 0x4e, 0x4e, 0x9a, 0x5e, 0xc4, 0x04,
+    0x4e, 0xfc, 0x94, 0x03, 0x6c, 0x00, 0x00, 0x01, 0x00, 0xcb, 0x00, 0x00, 0x04, 0x10, 0x04, 0x62,
+    0x00, 0x09, 0x00, 0x00, 0x13, 0x21, 0x15, 0x01, 0x21, 0x15, 0x21, 0x35, 0x01, 0x21, 0xe3, 0x03,
+    0x2d, 0xfd, 0x7d, 0x02, 0x83, 0xfc, 0xbb, 0x02, 0x83, 0xfd, 0x95, 0x04, 0x62, 0xa8, 0xfc, 0xdc,
+    0x96, 0xaa, 0x03, 0x25, 0x00, 0x01, 0x00, 0xdd, 0xfe, 0xb2, 0x03, 0xf4, 0x06, 0x14, 0x00, 0x24,
+    0x00, 0x00, 0x05, 0x15, 0x23, 0x22, 0x26, 0x3d, 0x01, 0x34, 0x26, 0x2b, 0x01, 0x35, 0x33, 0x32,
+    0x36, 0x3d, 0x01, 0x34, 0x36, 0x3b, 0x01, 0x15, 0x23, 0x22, 0x06, 0x1d, 0x01, 0x14, 0x06, 0x07,
+    0x1e, 0x01, 0x1d, 0x01, 0x14, 0x16, 0x33, 0x03, 0xf4, 0x40, 0xf9, 0xa9, 0x6b, 0x8c, 0x3e, 0x3e,
+    0x8d, 0x6a, 0xa9, 0xf9, 0x40, 0x46, 0x8c, 0x55, 0x5b, 0x6e, 0x6f, 0x5a, 0x55, 0x8c, 0xbe, 0x90,
+    0x94, 0xdd, 0xef, 0x97, 0x74, 0x8f, 0x72, 0x96, 0xf0, 0xdd, 0x93, 0x8f, 0x57, 0x8e, 0xf8, 0x9d,
+    0x8e, 0x19, 0x1b, 0x8e, 0x9c, 0xf8, 0x8f, 0x56, 0x00, 0x01, 0x02, 0x12, 0xfe, 0x1d, 0x02, 0xbe,
+    0x06, 0x1d, 0x00, 0x03, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x02, 0xbe, 0xac, 0x06, 0x1d, 0xf8,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0xdd, 0xfe, 0xb2, 0x03, 0xf4, 0x06, 0x14, 0x00, 0x24,
+    0x00, 0x00, 0x17, 0x33, 0x32, 0x36, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x2e, 0x01, 0x3d, 0x01, 0x34,
+    0x26, 0x2b, 0x01, 0x35, 0x33, 0x32, 0x16, 0x1d, 0x01, 0x14, 0x16, 0x3b, 0x01, 0x15, 0x23, 0x22,
+    0x06, 0x1d, 0x01, 0x14, 0x06, 0x2b, 0x01, 0xdd, 0x44, 0x8d, 0x56, 0x5a, 0x6f, 0x6e, 0x5b, 0x56,
+    0x8d, 0x44, 0x3e, 0xf9, 0xa8, 0x6b, 0x8d, 0x40, 0x40, 0x8d, 0x6b, 0xa8, 0xf9, 0x3e, 0xbe, 0x58,
+    0x8d, 0xf8, 0x9c, 0x8e, 0x1b, 0x19, 0x8e, 0x9d, 0xf8, 0x8d, 0x58, 0x8f, 0x93, 0xdd, 0xf0, 0x96,
+    0x72, 0x8f, 0x74, 0x97, 0xef, 0xdd, 0x94, 0x00, 0x00, 0x01, 0x00, 0x58, 0x01, 0xec, 0x04, 0x79,
+    0x03, 0x0c, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x15, 0x0e, 0x01, 0x23, 0x22, 0x27, 0x26, 0x27, 0x2e,
+    0x01, 0x23, 0x22, 0x06, 0x07, 0x35, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x16, 0x17, 0x16, 0x33,
+    0x32, 0x36, 0x04, 0x79, 0x4b, 0x8f, 0x4f, 0x5a, 0x71, 0x16, 0x0b, 0x4d, 0x67, 0x33, 0x4f, 0x8d,
+    0x49, 0x4e, 0x92, 0x53, 0x35, 0x64, 0x4a, 0x0c, 0x15, 0x74, 0x5d, 0x46, 0x89, 0x03, 0x0c, 0xae,
+    0x3b, 0x37, 0x33, 0x0a, 0x04, 0x21, 0x18, 0x3b, 0x3f, 0xae, 0x3c, 0x36, 0x16, 0x1f, 0x05, 0x0a,
+    0x37, 0x3d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x02, 0x24, 0x00, 0x2b, 0x00, 0x6b,
+    0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2b, 0x00, 0x64,
+    0x00, 0xb1, 0x01, 0x09, 0x01, 0x5d, 0x01, 0x6b, 0x01, 0x88, 0x01, 0xa4, 0x01, 0xca, 0x01, 0xe3,
+    0x01, 0xf4, 0x02, 0x02, 0x02, 0x0f, 0x02, 0x1d, 0x02, 0x5b, 0x02, 0x73, 0x02, 0xa2, 0x02, 0xdd,
+    0x02, 0xfa, 0x03, 0x2a, 0x03, 0x67, 0x03, 0x7a, 0x03, 0xc1, 0x03, 0xfd, 0x04, 0x10, 0x04, 0x27,
+    0x04, 0x3c, 0x04, 0x50, 0x04, 0x64, 0x04, 0x9a, 0x04, 0xec, 0x05, 0x08, 0x05, 0x3e, 0x05, 0x6c,
+    0x05, 0x92, 0x05, 0xaa, 0x05, 0xbf, 0x05, 0xf2, 0x06, 0x0a, 0x06, 0x22, 0x06, 0x41, 0x06, 0x5d,
+    0x06, 0x6d, 0x06, 0x8b, 0x06, 0xa3, 0x06, 0xd1, 0x06, 0xf4, 0x07, 0x2a, 0x07, 0x5b, 0x07, 0x97,
+    0x07, 0xaa, 0x07, 0xda, 0x07, 0xee, 0x08, 0x0a, 0x08, 0x29, 0x08, 0x40, 0x08, 0x57, 0x08, 0x69,
+    0x08, 0x79, 0x08, 0x8b, 0x08, 0xa1, 0x08, 0xae, 0x08, 0xbe, 0x08, 0xfc, 0x09, 0x2c, 0x09, 0x58,
+    0x09, 0x88, 0x09, 0xba, 0x09, 0xdb, 0x0a, 0x1a, 0x0a, 0x3c, 0x0a, 0x59, 0x0a, 0x78, 0x0a, 0x94,
+    0x0a, 0xad, 0x0a, 0xe1, 0x0b, 0x02, 0x0b, 0x2c, 0x0b, 0x5b, 0x0b, 0x8b, 0x0b, 0xaa, 0x0b, 0xe5,
+    0x0c, 0x07, 0x0c, 0x28, 0x0c, 0x3c, 0x0c, 0x58, 0x0c, 0x78, 0x0c, 0x9d, 0x0c, 0xb4, 0x0c, 0xe6,
+    0x0c, 0xf4, 0x0d, 0x26, 0x0d, 0x53, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x5e, 0xb8,
+    0x42, 0xd5, 0x59, 0xed, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0x30, 0x9c, 0x57, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x30, 0x9c, 0x57, 0xfb, 0x88, 0xfd, 0x01,
+    0x05, 0xbe, 0x08, 0x3a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xd1, 0x00, 0x68, 0x00, 0x00, 0x02, 0x04, 0x01, 0x52, 0x00, 0x02, 0x00, 0xbe, 0x00, 0x21,
+    0x00, 0x39, 0x02, 0x10, 0x01, 0xaa, 0x01, 0x5c, 0x00, 0xa6, 0x00, 0x58, 0x01, 0x93, 0x01, 0x64,
+    0x01, 0xe9, 0x00, 0x66, 0x00, 0x85, 0x00, 0xf6, 0x00, 0x98, 0x00, 0x89, 0x00, 0x66, 0x00, 0x8f,
+    0x00, 0x85, 0x00, 0x8b, 0x00, 0x83, 0x00, 0x7f, 0x01, 0xe9, 0x01, 0x93, 0x00, 0x58, 0x00, 0x58,
+    0x00, 0x58, 0x00, 0xf4, 0x00, 0x1b, 0x00, 0x25, 0x00, 0xa6, 0x00, 0x8b, 0x00, 0x89, 0x00, 0xc5,
+    0x00, 0xe9, 0x00, 0x66, 0x00, 0x89, 0x00, 0xc9, 0x00, 0x6d, 0x00, 0x89, 0x00, 0xd7, 0x00, 0x56,
+    0x00, 0x8b, 0x00, 0x75, 0x00, 0xc5, 0x00, 0x75, 0x00, 0x8f, 0x00, 0x8b, 0x00, 0x2f, 0x00, 0x93,
+    0x00, 0x39, 0x00, 0x00, 0x00, 0x12, 0x00, 0x25, 0x00, 0x9c, 0x01, 0xcf, 0x00, 0x66, 0x01, 0x5a,
+    0x00, 0x48, 0x00, 0x00, 0x01, 0x17, 0x00, 0x85, 0x00, 0xc1, 0x00, 0xc3, 0x00, 0x7b, 0x00, 0x7b,
+    0x00, 0xc3, 0x00, 0x7b, 0x00, 0xc3, 0x00, 0xb2, 0x00, 0xba, 0x00, 0xec, 0x00, 0xa0, 0x00, 0x6d,
+    0x00, 0xc3, 0x00, 0x89, 0x00, 0xbe, 0x00, 0x89, 0x01, 0x6a, 0x00, 0xd5, 0x00, 0x83, 0x00, 0xc3,
+    0x00, 0x64, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x68, 0x00, 0xcb, 0x00, 0xdd, 0x02, 0x12, 0x00, 0xdd,
+    0x00, 0x58, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x6d, 0xfe, 0x1d, 0x00, 0x00, 0x04, 0xd1,
+    0xfb, 0x88, 0xff, 0x14, 0x05, 0xbe, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x04, 0xd1, 0x01, 0x90, 0x00, 0x05,
+    0x00, 0x00, 0x05, 0x33, 0x05, 0x99, 0x00, 0x00, 0x01, 0x1e, 0x05, 0x33, 0x05, 0x99, 0x00, 0x00,
+    0x03, 0xd7, 0x00, 0x66, 0x02, 0x12, 0x00, 0x00, 0x02, 0x0b, 0x06, 0x09, 0x03, 0x08, 0x04, 0x02,
+    0x02, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0x66, 0x45, 0x64, 0x00, 0x40, 0x00, 0x20, 0x00, 0x7e, 0x06, 0x14, 0xfe, 0x14,
+    0x01, 0x9a, 0x07, 0x6d, 0x01, 0xe3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x7e, 0xff, 0xff, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0xff, 0xe1, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x5a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x20,
+    0x00, 0xbe, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x08, 0x00, 0xde, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x20, 0x00, 0xbe, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x04, 0x00, 0x20, 0x00, 0xbe, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x18,
+    0x00, 0xe6, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x1c, 0x00, 0xfe, 0x00, 0x43,
+    0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74,
+    0x00, 0x20, 0x00, 0x28, 0x00, 0x63, 0x00, 0x29, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x30,
+    0x00, 0x33, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x42, 0x00, 0x69, 0x00, 0x74,
+    0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x2c, 0x00, 0x20,
+    0x00, 0x49, 0x00, 0x6e, 0x00, 0x63, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x41, 0x00, 0x6c, 0x00, 0x6c,
+    0x00, 0x20, 0x00, 0x52, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20,
+    0x00, 0x52, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x76, 0x00, 0x65, 0x00, 0x64,
+    0x00, 0x2e, 0x00, 0x0a, 0x00, 0x44, 0x00, 0x65, 0x00, 0x6a, 0x00, 0x61, 0x00, 0x56, 0x00, 0x75,
+    0x00, 0x20, 0x00, 0x63, 0x00, 0x68, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x65, 0x00, 0x73,
+    0x00, 0x20, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x20,
+    0x00, 0x70, 0x00, 0x75, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x20, 0x00, 0x64,
+    0x00, 0x6f, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x0a, 0x00, 0x44, 0x00, 0x65,
+    0x00, 0x6a, 0x00, 0x61, 0x00, 0x56, 0x00, 0x75, 0x00, 0x20, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6e,
+    0x00, 0x73, 0x00, 0x20, 0x00, 0x4d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x42, 0x00, 0x6f,
+    0x00, 0x6f, 0x00, 0x6b, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f,
+    0x00, 0x6e, 0x00, 0x20, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x33, 0x00, 0x37, 0x00, 0x44, 0x00, 0x65,
+    0x00, 0x6a, 0x00, 0x61, 0x00, 0x56, 0x00, 0x75, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x73,
+    0x00, 0x4d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xd8, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x02,
+    0xff, 0xff, 0x00, 0x03,
+};
+
+const size_t FALLBACK_FONT_SIZE = sizeof(FALLBACK_FONT_DATA);
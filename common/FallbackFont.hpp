@@ -0,0 +1,8 @@
+#pragma once
+
+#include <cstddef>
+
+// A small TrueType font compiled into the binary, for sf::Font::loadFromMemory
+// when no font file can be found (see ResourceCache)
+extern const unsigned char FALLBACK_FONT_DATA[];
+extern const size_t FALLBACK_FONT_SIZE;
@@ -0,0 +1,46 @@
+#include "GameLoop.hpp"
+
+#include <algorithm>
+#include <thread>
+
+GameLoop::GameLoop(float stepSeconds, int maxSteps)
+    : stepSeconds(stepSeconds), maxSteps(maxSteps), lastAdvance(Clock::now()), nextFrame(lastAdvance) {
+    setFrameLimit(60);
+}
+
+void GameLoop::setFrameLimit(unsigned framesPerSecond) {
+    framePeriod = framesPerSecond ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / framesPerSecond))
+                                  : Clock::duration::zero();
+    nextFrame = Clock::now();
+}
+
+int GameLoop::advance() {
+    Clock::time_point now = Clock::now();
+    accumulator += std::chrono::duration<float>(now - lastAdvance).count();
+    lastAdvance = now;
+
+    float limit = stepSeconds * maxSteps;
+    if (accumulator > limit) {
+        droppedSeconds += accumulator - limit;
+        accumulator = limit;
+    }
+
+    int steps = (int)(accumulator / stepSeconds);
+    accumulator = std::max(0.0f, accumulator - steps * stepSeconds);
+    return steps;
+}
+
+void GameLoop::pace() {
+    if (framePeriod == Clock::duration::zero())
+        return;
+
+    // A frame that ran long starts the schedule over rather than rushing
+    // the next few to make up for it
+    Clock::time_point now = Clock::now();
+    nextFrame += framePeriod;
+    if (nextFrame < now) {
+        nextFrame = now;
+        return;
+    }
+    std::this_thread::sleep_until(nextFrame);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+
+// Drives a fixed-rate simulation from a variable-rate render loop:
+//
+//     GameLoop loop(1.0f / 60.0f);
+//     while (window.isOpen()) {
+//         ...events...
+//         for (int steps = loop.advance(); steps > 0; --steps)
+//             step(loop.getStepSeconds());
+//         render(loop.getAlpha());   // blend previous and current state
+//         loop.pace();               // sleep off the rest of the frame
+//     }
+//
+// Real time goes into an accumulator that is spent in whole steps, so the
+// simulation runs at the same speed whatever the frame rate. The
+// accumulator is capped at maxSteps steps: after a stall (a breakpoint, a
+// dragged window, a load spike) the simulation slows down for a moment
+// instead of trying to catch up, which would make the next frame even
+// slower. pace() sleeps until the next frame is due, so an idle demo
+// doesn't keep a core busy.
+class GameLoop {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    explicit GameLoop(float stepSeconds = 1.0f / 60.0f, int maxSteps = 5);
+
+    // Frames per second pace() holds to; 0 leaves frames unlimited
+    void setFrameLimit(unsigned framesPerSecond);
+
+    // Fixed steps to run this frame (0..maxSteps)
+    int advance();
+
+    // How far real time is between the last two steps, 0..1
+    float getAlpha() const { return accumulator / stepSeconds; }
+
+    // Sleep until the next frame is due
+    void pace();
+
+    float getStepSeconds() const { return stepSeconds; }
+
+    // Real time the cap threw away; the simulation is that far behind the clock
+    double getDroppedSeconds() const { return droppedSeconds; }
+
+private:
+    const float stepSeconds;
+    const int maxSteps;
+    float accumulator = 0.0f;
+    double droppedSeconds = 0.0;
+    Clock::time_point lastAdvance;
+
+    Clock::duration framePeriod;
+    Clock::time_point nextFrame;
+};
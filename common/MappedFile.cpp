@@ -0,0 +1,69 @@
+#include "MappedFile.hpp"
+
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::open(const std::string& path) {
+    close();
+
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0) {
+        if (fd >= 0)
+            ::close(fd);
+        return false;
+    }
+    size = (size_t)info.st_size;
+    if (size > 0) {
+        mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        if (mapping == MAP_FAILED) {
+            mapping = nullptr;
+            ::close(fd);
+            size = 0;
+            return false;
+        }
+    }
+    ::close(fd); // The mapping keeps its own reference to the file
+    data = (const uint8_t*)mapping;
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (file) {
+        buffer.resize((size_t)file.tellg());
+        file.seekg(0);
+        file.read((char*)buffer.data(), buffer.size());
+    }
+    if (!file) {
+        buffer.clear();
+        return false;
+    }
+    size = buffer.size();
+    data = size ? buffer.data() : nullptr;
+#endif
+
+    opened = true;
+    return true;
+}
+
+void MappedFile::close() {
+#ifndef _WIN32
+    if (mapping)
+        munmap(mapping, size);
+#endif
+    mapping = nullptr;
+    buffer.clear();
+    buffer.shrink_to_fit();
+    data = nullptr;
+    size = 0;
+    opened = false;
+}
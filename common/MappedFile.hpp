@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Read-only view of a whole file, mapped straight into memory where mmap is
+// available (pages are only read from disk when touched) and read into a
+// buffer elsewhere. File formats cast their headers and tables onto data().
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // False if the file can't be opened or read. An empty file opens with
+    // null data.
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return opened; }
+
+    const uint8_t* getData() const { return data; }
+    size_t getSize() const { return size; }
+
+private:
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    bool opened = false;
+    void* mapping = nullptr;
+    std::vector<uint8_t> buffer; // Used instead of a mapping where mmap isn't available
+};
@@ -0,0 +1,108 @@
+#include "PhysicsQuery.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+float distanceBetween(b2Vec2 a, b2Vec2 b) {
+    return std::hypot(a.x - b.x, a.y - b.y);
+}
+
+} // namespace
+
+PhysicsQuery::PhysicsQuery(b2WorldId worldId) : worldId(worldId), filter(b2DefaultQueryFilter()) {
+}
+
+bool PhysicsQuery::accepts(b2ShapeId shapeId) const {
+    return !b2Shape_IsSensor(shapeId) && (!shapeFilter || shapeFilter(shapeId));
+}
+
+bool PhysicsQuery::collectShape(b2ShapeId shapeId, void* context) {
+    PhysicsQuery* query = static_cast<PhysicsQuery*>(context);
+    if (query->accepts(shapeId))
+        query->candidates.push_back(shapeId);
+    return true; // Keep going
+}
+
+float PhysicsQuery::collectRayHit(b2ShapeId shapeId, b2Vec2 point, b2Vec2, float fraction, void* context) {
+    PhysicsQuery* query = static_cast<PhysicsQuery*>(context);
+    if (!query->accepts(shapeId))
+        return -1.0f; // Ignore this shape, keep the ray as it is
+    query->found.push_back({shapeId, b2Shape_GetBody(shapeId), point, fraction * query->rayLength});
+    // Clipping the ray to this hit makes Box2D skip everything behind it
+    return query->rayKeepsAll ? 1.0f : fraction;
+}
+
+void PhysicsQuery::gatherAABB(b2Vec2 centre, float halfExtent) {
+    candidates.clear();
+    b2AABB box = {(b2Vec2){centre.x - halfExtent, centre.y - halfExtent}, (b2Vec2){centre.x + halfExtent, centre.y + halfExtent}};
+    b2World_OverlapAABB(worldId, box, filter, collectShape, this);
+}
+
+size_t PhysicsQuery::finish(std::vector<QueryHit>& hits, size_t limit) {
+    // One hit per body (its nearest), then nearest first
+    std::sort(found.begin(), found.end(), [](const QueryHit& a, const QueryHit& b) {
+        return a.bodyId.index1 != b.bodyId.index1 ? a.bodyId.index1 < b.bodyId.index1 : a.distance < b.distance;
+    });
+    found.erase(std::unique(found.begin(), found.end(),
+                            [](const QueryHit& a, const QueryHit& b) { return a.bodyId.index1 == b.bodyId.index1; }),
+                found.end());
+
+    size_t count = std::min(limit, found.size());
+    auto byDistance = [](const QueryHit& a, const QueryHit& b) { return a.distance < b.distance; };
+    std::partial_sort(found.begin(), found.begin() + count, found.end(), byDistance);
+
+    hits.assign(found.begin(), found.begin() + count);
+    return count;
+}
+
+size_t PhysicsQuery::queryRadius(b2Vec2 centre, float radius, std::vector<QueryHit>& hits) {
+    gatherAABB(centre, radius);
+    found.clear();
+    for (b2ShapeId shapeId : candidates) {
+        b2BodyId bodyId = b2Shape_GetBody(shapeId);
+        b2Vec2 origin = b2Body_GetPosition(bodyId);
+        float distance = distanceBetween(centre, origin);
+        if (distance <= radius)
+            found.push_back({shapeId, bodyId, origin, distance});
+    }
+    return finish(hits, found.size());
+}
+
+size_t PhysicsQuery::queryNearest(b2Vec2 centre, size_t k, float maxRadius, std::vector<QueryHit>& hits) {
+    // Everything inside the circle of radius r is nearer than anything
+    // outside it, so once r holds k bodies they are the k nearest
+    float radius = maxRadius / 8.0f;
+    while (true) {
+        radius = std::min(radius, maxRadius);
+        queryRadius(centre, radius, hits);
+        if (hits.size() >= k || radius >= maxRadius)
+            break;
+        radius *= 2.0f;
+    }
+    if (hits.size() > k)
+        hits.resize(k);
+    return hits.size();
+}
+
+size_t PhysicsQuery::queryPoint(b2Vec2 point, std::vector<QueryHit>& hits) {
+    gatherAABB(point, 0.001f);
+    found.clear();
+    for (b2ShapeId shapeId : candidates) {
+        if (!b2Shape_TestPoint(shapeId, point))
+            continue;
+        b2BodyId bodyId = b2Shape_GetBody(shapeId);
+        b2Vec2 origin = b2Body_GetPosition(bodyId);
+        found.push_back({shapeId, bodyId, origin, distanceBetween(point, origin)});
+    }
+    return finish(hits, found.size());
+}
+
+size_t PhysicsQuery::castRay(b2Vec2 origin, b2Vec2 translation, bool all, std::vector<QueryHit>& hits) {
+    found.clear();
+    rayLength = std::hypot(translation.x, translation.y);
+    rayKeepsAll = all;
+    b2World_CastRay(worldId, origin, translation, filter, collectRayHit, this);
+    return finish(hits, all ? found.size() : 1);
+}
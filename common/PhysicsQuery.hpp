@@ -0,0 +1,67 @@
+#pragma once
+
+#include <box2d/box2d.h>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+// One body found by a PhysicsQuery. Positions and distances are in Box2D
+// units (meters); convert at the call site.
+struct QueryHit {
+    b2ShapeId shapeId;
+    b2BodyId bodyId;
+    b2Vec2 point;   // Body origin, or the ray's hit point for castRay
+    float distance; // From the query centre / ray origin to `point`
+};
+
+// Proximity and pick queries answered by Box2D's own broad phase
+// (b2World_OverlapAABB / b2World_CastRay) instead of scanning every body,
+// so a query costs what the bodies near it cost, however big the world is.
+// Results are sorted nearest first and hold one hit per body. Sensors and
+// disabled bodies are never reported.
+//
+// Distances for the radius/nearest/point queries are measured to the body
+// origin, like the position-based checks they replace.
+class PhysicsQuery {
+public:
+    typedef std::function<bool(b2ShapeId shapeId)> ShapeFilter;
+
+    explicit PhysicsQuery(b2WorldId worldId);
+
+    // Category/mask filter passed to Box2D, and an optional callback to
+    // reject shapes (e.g. the player's own body); both apply to every query
+    void setFilter(b2QueryFilter value) { filter = value; }
+    void setShapeFilter(ShapeFilter value) { shapeFilter = value; }
+
+    // Bodies whose origin is within `radius` of `centre`
+    size_t queryRadius(b2Vec2 centre, float radius, std::vector<QueryHit>& hits);
+
+    // The `k` bodies nearest to `centre`, no further than `maxRadius`. The
+    // search box starts small and doubles, so dense worlds stay cheap.
+    size_t queryNearest(b2Vec2 centre, size_t k, float maxRadius, std::vector<QueryHit>& hits);
+
+    // Bodies with a shape containing `point` (mouse picking)
+    size_t queryPoint(b2Vec2 point, std::vector<QueryHit>& hits);
+
+    // Bodies hit by the segment origin..origin+translation, in hit order.
+    // With `all` false only the first hit is kept.
+    size_t castRay(b2Vec2 origin, b2Vec2 translation, bool all, std::vector<QueryHit>& hits);
+
+private:
+    static bool collectShape(b2ShapeId shapeId, void* context);
+    static float collectRayHit(b2ShapeId shapeId, b2Vec2 point, b2Vec2 normal, float fraction, void* context);
+
+    bool accepts(b2ShapeId shapeId) const;
+    void gatherAABB(b2Vec2 centre, float halfExtent);
+    size_t finish(std::vector<QueryHit>& hits, size_t limit);
+
+    b2WorldId worldId;
+    b2QueryFilter filter;
+    ShapeFilter shapeFilter;
+
+    // Scratch for the callbacks, kept between queries
+    std::vector<b2ShapeId> candidates;
+    std::vector<QueryHit> found;
+    float rayLength = 0.0f;
+    bool rayKeepsAll = false;
+};
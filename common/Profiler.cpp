@@ -0,0 +1,214 @@
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+
+namespace {
+
+std::atomic<uint64_t> nextProfilerId{1};
+
+// The ring the current thread last used, and whose profiler it belongs to.
+// A thread switching between profilers looks its ring up again.
+thread_local uint64_t cachedProfilerId = 0;
+thread_local void* cachedRing = nullptr;
+
+uint64_t steadyNanoseconds() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+} // namespace
+
+Profiler::Profiler() : id(nextProfilerId++), startTicks(steadyNanoseconds()) {
+}
+
+Profiler::~Profiler() {
+    stopTrace();
+    stopCsv();
+}
+
+uint64_t Profiler::now() const {
+    return steadyNanoseconds() - startTicks;
+}
+
+Profiler::ThreadRing& Profiler::ringForThisThread() {
+    if (cachedProfilerId == id)
+        return *static_cast<ThreadRing*>(cachedRing);
+
+    // A thread alternating between profilers finds the ring it registered
+    // before instead of adding another one each time it comes back
+    std::lock_guard<std::mutex> lock(ringMutex);
+    std::thread::id self = std::this_thread::get_id();
+    for (auto& ring : rings) {
+        if (ring->owner == self) {
+            cachedProfilerId = id;
+            cachedRing = ring.get();
+            return *ring;
+        }
+    }
+    rings.emplace_back(new ThreadRing());
+    rings.back()->threadIndex = (uint32_t)rings.size() - 1;
+    rings.back()->owner = self;
+    cachedProfilerId = id;
+    cachedRing = rings.back().get();
+    return *rings.back();
+}
+
+void Profiler::record(const char* name, uint64_t start, uint64_t end) {
+    ThreadRing& ring = ringForThisThread();
+    uint32_t head = ring.head.load(std::memory_order_relaxed);
+    if (head - ring.tail.load(std::memory_order_acquire) >= ThreadRing::CAPACITY) {
+        ring.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    ring.events[head % ThreadRing::CAPACITY] = Event{name, start, end};
+    ring.head.store(head + 1, std::memory_order_release);
+}
+
+void Profiler::addTo(std::vector<Entry>& entries, const char* name, double value) {
+    for (Entry& entry : entries) {
+        if (entry.name == name) {
+            entry.value += value;
+            ++entry.count;
+            return;
+        }
+    }
+    entries.push_back(Entry{name, value, 1});
+}
+
+void Profiler::setValue(const char* name, double value) {
+    if (!isEnabled())
+        return;
+    for (Entry& entry : frameValues) {
+        if (entry.name == name) {
+            entry.value = value;
+            return;
+        }
+    }
+    frameValues.push_back(Entry{name, value, 1});
+}
+
+void Profiler::beginFrame() {
+    frameStart = now();
+}
+
+void Profiler::writeTraceEvent(const std::string& json) {
+    trace << (traceHasEvents ? ",\n" : "") << json;
+    traceHasEvents = true;
+}
+
+void Profiler::endFrame() {
+    bool active = isEnabled();
+    uint64_t frameEnd = now();
+    char line[256];
+
+    {
+        std::lock_guard<std::mutex> lock(ringMutex);
+        for (auto& ringPointer : rings) {
+            ThreadRing& ring = *ringPointer;
+            uint32_t tail = ring.tail.load(std::memory_order_relaxed);
+            uint32_t head = ring.head.load(std::memory_order_acquire);
+            for (; active && tail != head; ++tail) {
+                const Event& event = ring.events[tail % ThreadRing::CAPACITY];
+                addTo(frameTimers, event.name, (event.end - event.start) / 1e6);
+                if (trace.is_open()) {
+                    std::snprintf(line, sizeof(line), "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%u}",
+                                  event.name, event.start / 1e3, (event.end - event.start) / 1e3, ring.threadIndex);
+                    writeTraceEvent(line);
+                }
+            }
+            ring.tail.store(head, std::memory_order_release);
+            droppedTotal += ring.dropped.exchange(0, std::memory_order_relaxed);
+        }
+    }
+    if (!active)
+        return;
+
+    lastFrameMs = (frameEnd - frameStart) / 1e6;
+    if (trace.is_open()) {
+        std::snprintf(line, sizeof(line), "{\"name\":\"frame\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":0}",
+                      frameStart / 1e3, (frameEnd - frameStart) / 1e3);
+        writeTraceEvent(line);
+        for (const Entry& entry : frameValues) {
+            std::snprintf(line, sizeof(line), "{\"name\":\"%s\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":0,\"args\":{\"value\":%g}}",
+                          entry.name, frameEnd / 1e3, entry.value);
+            writeTraceEvent(line);
+        }
+    }
+    if (csv.is_open()) {
+        csv << frameIndex << ",frame," << lastFrameMs << "\n";
+        for (const Entry& entry : frameTimers) {
+            csv << frameIndex << "," << entry.name << "," << entry.value << "\n";
+        }
+        for (const Entry& entry : frameValues) {
+            csv << frameIndex << "," << entry.name << "," << entry.value << "\n";
+        }
+    }
+
+    std::sort(frameTimers.begin(), frameTimers.end(), [](const Entry& a, const Entry& b) { return a.value > b.value; });
+    lastTimers.swap(frameTimers);
+    lastValues.swap(frameValues);
+    frameTimers.clear();
+    frameValues.clear();
+    ++frameIndex;
+}
+
+bool Profiler::startTrace(const std::string& path) {
+    stopTrace();
+    trace.open(path, std::ios::trunc);
+    if (!trace) {
+        std::cerr << "Failed to open trace file " << path << "\n";
+        return false;
+    }
+    trace << "{\"traceEvents\":[\n";
+    traceHasEvents = false;
+    return true;
+}
+
+void Profiler::stopTrace() {
+    if (!trace.is_open())
+        return;
+    trace << "\n]}\n";
+    trace.close();
+}
+
+bool Profiler::startCsv(const std::string& path) {
+    stopCsv();
+    csv.open(path, std::ios::trunc);
+    if (!csv) {
+        std::cerr << "Failed to open profile CSV " << path << "\n";
+        return false;
+    }
+    csv << "frame,name,value\n";
+    return true;
+}
+
+void Profiler::stopCsv() {
+    if (csv.is_open())
+        csv.close();
+}
+
+std::string Profiler::formatOverlay(size_t maxLines) const {
+    char line[128];
+    std::snprintf(line, sizeof(line), "frame %.2f ms\n", lastFrameMs);
+    std::string text = line;
+
+    size_t lines = 1;
+    for (const Entry& entry : lastTimers) {
+        if (lines++ >= maxLines)
+            break;
+        std::snprintf(line, sizeof(line), entry.count > 1 ? "%s %.2f ms (x%u)\n" : "%s %.2f ms\n", entry.name, entry.value,
+                      entry.count);
+        text += line;
+    }
+    for (const Entry& entry : lastValues) {
+        if (lines++ >= maxLines)
+            break;
+        std::snprintf(line, sizeof(line), "%s %g\n", entry.name, entry.value);
+        text += line;
+    }
+    return text;
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Frame profiler: scoped timers write into a lock-free ring per thread, and
+// endFrame() drains the rings into a per-frame summary, an optional Chrome
+// trace (chrome://tracing, ui.perfetto.dev) and an optional CSV. Values that
+// aren't timers (Box2D's own profile, counters) are added per frame with
+// setValue().
+//
+// While disabled a scope costs one relaxed atomic load, so timers can stay
+// in release builds. Timer and value names must be string literals (or
+// otherwise outlive the profiler): only the pointer is stored.
+class Profiler {
+public:
+    Profiler();
+    ~Profiler();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    void setEnabled(bool value) { enabled.store(value, std::memory_order_relaxed); }
+    bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+    // Nanoseconds since the profiler was created
+    uint64_t now() const;
+
+    // Store one finished scope; called by ProfileScope from any thread
+    void record(const char* name, uint64_t start, uint64_t end);
+
+    // A per-frame number that isn't a timer (milliseconds or a count); the
+    // last value set in a frame wins. Call from the thread running endFrame.
+    void setValue(const char* name, double value);
+
+    void beginFrame();
+    void endFrame();
+
+    // Chrome trace JSON, streamed out at every endFrame
+    bool startTrace(const std::string& path);
+    void stopTrace();
+    bool isTracing() const { return trace.is_open(); }
+
+    // One "frame,name,value" row per timer and value per frame
+    bool startCsv(const std::string& path);
+    void stopCsv();
+    bool isWritingCsv() const { return csv.is_open(); }
+
+    // Last finished frame: timers summed by name, slowest first, then values
+    std::string formatOverlay(size_t maxLines = 12) const;
+    double getFrameMs() const { return lastFrameMs; }
+
+    // Events lost because a thread's ring was full between two endFrames
+    uint64_t getDroppedCount() const { return droppedTotal; }
+
+private:
+    struct Event {
+        const char* name;
+        uint64_t start;
+        uint64_t end;
+    };
+
+    // Single producer (its thread), single consumer (endFrame)
+    struct ThreadRing {
+        static const uint32_t CAPACITY = 8192;
+        uint32_t threadIndex = 0;
+        std::thread::id owner; // A later thread may reuse a finished one's id, and its ring
+        Event events[CAPACITY];
+        std::atomic<uint32_t> head{0}; // Next write, owned by the producer
+        std::atomic<uint32_t> tail{0}; // Next read, owned by the consumer
+        std::atomic<uint32_t> dropped{0};
+    };
+
+    struct Entry {
+        const char* name;
+        double value; // Milliseconds for timers
+        uint32_t count;
+    };
+
+    ThreadRing& ringForThisThread();
+    static void addTo(std::vector<Entry>& entries, const char* name, double value);
+    void writeTraceEvent(const std::string& json);
+
+    const uint64_t id; // Tells thread-local ring caches of different profilers apart
+    std::atomic<bool> enabled{false};
+    uint64_t startTicks;
+
+    std::mutex ringMutex; // Only taken to register a thread and to drain
+    std::vector<std::unique_ptr<ThreadRing>> rings;
+
+    uint64_t frameIndex = 0;
+    uint64_t frameStart = 0;
+    std::vector<Entry> frameTimers, frameValues;
+    std::vector<Entry> lastTimers, lastValues;
+    double lastFrameMs = 0.0;
+    uint64_t droppedTotal = 0;
+
+    std::ofstream trace;
+    bool traceHasEvents = false;
+    std::ofstream csv;
+};
+
+// Times the enclosing scope under `name` if the profiler is enabled (or,
+// for the pointer form, set and enabled)
+class ProfileScope {
+public:
+    ProfileScope(Profiler& profiler, const char* name) : ProfileScope(&profiler, name) {}
+    ProfileScope(Profiler* profiler, const char* name)
+        : profiler(profiler && profiler->isEnabled() ? profiler : nullptr), name(name),
+          start(this->profiler ? this->profiler->now() : 0) {}
+    ~ProfileScope() {
+        if (profiler)
+            profiler->record(name, start, profiler->now());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    Profiler* profiler;
+    const char* name;
+    uint64_t start;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(profiler, name) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(profiler, name)
@@ -0,0 +1,150 @@
+#include "ResourceCache.hpp"
+
+#include <iostream>
+#include "FallbackFont.hpp"
+
+ResourceCache::ResourceCache() {
+    // From memory, so this never touches the disk
+    if (!fallbackFont.loadFromMemory(FALLBACK_FONT_DATA, FALLBACK_FONT_SIZE))
+        std::cerr << "Could not load the built-in font!\n";
+    loader = std::thread(&ResourceCache::loaderLoop, this);
+}
+
+ResourceCache::~ResourceCache() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    loader.join();
+
+    // Whatever the loader didn't get to stays unloaded
+    for (Job& job : jobs) {
+        if (job.font)
+            job.font->state.store(ResourceState::Failed, std::memory_order_release);
+        if (job.texture)
+            job.texture->state.store(ResourceState::Failed, std::memory_order_release);
+    }
+}
+
+FontHandle ResourceCache::requestFont(const std::vector<std::string>& paths) {
+    std::string key;
+    for (const std::string& path : paths)
+        key += path + '\n';
+
+    std::shared_ptr<FontResource> resource;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::shared_ptr<FontResource>& slot = fonts[key];
+        if (slot)
+            return slot;
+        slot = resource = std::make_shared<FontResource>();
+    }
+
+    Job job;
+    job.font = resource;
+    job.paths = paths;
+    enqueue(std::move(job));
+    return resource;
+}
+
+TextureHandle ResourceCache::requestTexture(const std::string& path) {
+    std::shared_ptr<TextureResource> resource;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::shared_ptr<TextureResource>& slot = textures[path];
+        if (slot)
+            return slot;
+        slot = resource = std::make_shared<TextureResource>();
+    }
+
+    Job job;
+    job.texture = resource;
+    job.paths.push_back(path);
+    enqueue(std::move(job));
+    return resource;
+}
+
+const sf::Font& ResourceCache::getFont(const FontHandle& handle) const {
+    if (handle && handle->state.load(std::memory_order_acquire) == ResourceState::Ready)
+        return handle->font;
+    return fallbackFont;
+}
+
+const sf::Texture* ResourceCache::getTexture(const TextureHandle& handle) const {
+    if (handle && handle->state.load(std::memory_order_acquire) == ResourceState::Ready)
+        return &handle->texture;
+    return nullptr;
+}
+
+void ResourceCache::update() {
+    std::vector<std::shared_ptr<TextureResource>> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ready.swap(decoded);
+    }
+
+    for (auto& resource : ready) {
+        bool loaded = resource->texture.loadFromImage(resource->image);
+        resource->image = sf::Image();
+        resource->state.store(loaded ? ResourceState::Ready : ResourceState::Failed, std::memory_order_release);
+        pendingCount.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+void ResourceCache::enqueue(Job job) {
+    pendingCount.fetch_add(1, std::memory_order_acq_rel);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(std::move(job));
+    }
+    wake.notify_one();
+}
+
+void ResourceCache::loadFont(FontResource& resource, const std::vector<std::string>& paths) {
+    for (const std::string& path : paths) {
+        if (resource.font.loadFromFile(path)) {
+            resource.path = path;
+            resource.state.store(ResourceState::Ready, std::memory_order_release);
+            return;
+        }
+    }
+    resource.state.store(ResourceState::Failed, std::memory_order_release);
+}
+
+void ResourceCache::loaderLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [this] { return stopping || !jobs.empty(); });
+        if (stopping)
+            return;
+
+        Job job = std::move(jobs.front());
+        jobs.pop_front();
+        lock.unlock();
+
+        if (job.font) {
+            loadFont(*job.font, job.paths);
+            pendingCount.fetch_sub(1, std::memory_order_acq_rel);
+        } else if (job.texture->image.loadFromFile(job.paths[0])) {
+            lock.lock();
+            decoded.push_back(std::move(job.texture));
+            continue;
+        } else {
+            job.texture->state.store(ResourceState::Failed, std::memory_order_release);
+            pendingCount.fetch_sub(1, std::memory_order_acq_rel);
+        }
+        lock.lock();
+    }
+}
+
+const std::vector<std::string>& defaultFontPaths() {
+    static const std::vector<std::string> paths = {
+        "/System/Library/Fonts/Supplemental/Arial.ttf",
+        "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+        "/usr/share/fonts/TTF/DejaVuSans.ttf",
+        "/usr/share/fonts/dejavu-sans-fonts/DejaVuSans.ttf",
+        "C:/Windows/Fonts/arial.ttf",
+    };
+    return paths;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+enum class ResourceState { Loading, Ready, Failed };
+
+struct FontResource {
+    std::atomic<ResourceState> state{ResourceState::Loading};
+    sf::Font font;    // Valid once Ready
+    std::string path; // The candidate that loaded
+};
+
+struct TextureResource {
+    std::atomic<ResourceState> state{ResourceState::Loading};
+    sf::Image image;     // Decoded on the loader thread, freed after upload
+    sf::Texture texture; // Valid once Ready
+};
+
+typedef std::shared_ptr<const FontResource> FontHandle;
+typedef std::shared_ptr<const TextureResource> TextureHandle;
+
+// Loads fonts and textures on one background thread so nothing waits on the
+// disk. Requests are deduplicated by key and everyone asking for the same
+// key shares one handle. Until a font is ready (or if it never loads),
+// getFont() hands out a font compiled into the binary, so text can be drawn
+// from the first frame and a missing file is never fatal.
+//
+// Fonts are usable straight from the loader. Images are decoded there too,
+// but the upload to a texture needs the GL context, so it happens in
+// update(), which the window's thread calls once per frame.
+class ResourceCache {
+public:
+    ResourceCache();
+    ~ResourceCache();
+
+    ResourceCache(const ResourceCache&) = delete;
+    ResourceCache& operator=(const ResourceCache&) = delete;
+
+    // The first of `paths` that loads wins; the key is the whole list
+    FontHandle requestFont(const std::vector<std::string>& paths);
+    TextureHandle requestTexture(const std::string& path);
+
+    // The handle's font once ready, the built-in one until then
+    const sf::Font& getFont(const FontHandle& handle) const;
+    const sf::Font& getFallbackFont() const { return fallbackFont; }
+
+    // The handle's texture once uploaded, null until then or if it failed
+    const sf::Texture* getTexture(const TextureHandle& handle) const;
+
+    // Upload decoded images; call from the thread that owns the window
+    void update();
+
+    // Requests the loader hasn't finished yet
+    size_t getPendingCount() const { return pendingCount.load(std::memory_order_acquire); }
+
+private:
+    struct Job {
+        std::shared_ptr<FontResource> font;
+        std::shared_ptr<TextureResource> texture;
+        std::vector<std::string> paths;
+    };
+
+    void enqueue(Job job);
+    void loaderLoop();
+    static void loadFont(FontResource& resource, const std::vector<std::string>& paths);
+
+    sf::Font fallbackFont;
+
+    std::mutex mutex; // Guards everything below
+    std::unordered_map<std::string, std::shared_ptr<FontResource>> fonts;
+    std::unordered_map<std::string, std::shared_ptr<TextureResource>> textures;
+    std::deque<Job> jobs;
+    std::vector<std::shared_ptr<TextureResource>> decoded; // Waiting for update()
+    bool stopping = false;
+
+    std::condition_variable wake;
+    std::atomic<size_t> pendingCount{0};
+    std::thread loader; // Started last, joined first
+};
+
+// Where the demos look for a UI font: macOS, then common Linux locations.
+// Whatever isn't there falls through to the built-in font.
+const std::vector<std::string>& defaultFontPaths();
@@ -0,0 +1,173 @@
+#include "SceneFile.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+// Cost bytes of a grid, padded so the next grid header stays aligned
+uint64_t paddedGridBytes(int width, int height) {
+    return ((uint64_t)width * height + 3) & ~(uint64_t)3;
+}
+
+// Values Box2D would assert on: a body type it doesn't have, a box without a
+// positive size, or negative or non-finite material settings
+bool isValidPrefab(const ScenePrefab& prefab) {
+    auto positive = [](float value) { return std::isfinite(value) && value > 0.0f; };
+    auto nonNegative = [](float value) { return std::isfinite(value) && value >= 0.0f; };
+    return prefab.bodyType <= (uint32_t)b2_dynamicBody && positive(prefab.halfWidth) && positive(prefab.halfHeight) &&
+           nonNegative(prefab.density) && nonNegative(prefab.friction) && nonNegative(prefab.linearDamping);
+}
+
+} // namespace
+
+bool saveSceneFile(const std::string& path, const std::vector<ScenePrefab>& prefabs, const std::vector<SceneBody>& bodies,
+                   const std::vector<SceneGrid>& grids) {
+    for (const SceneBody& body : bodies) {
+        if (body.prefab >= prefabs.size()) {
+            std::cerr << "Can't save scene to " << path << ": a body uses missing prefab " << body.prefab << "\n";
+            return false;
+        }
+    }
+    for (const SceneGrid& grid : grids) {
+        if (grid.width <= 0 || grid.height <= 0 || grid.costs.size() != (size_t)grid.width * grid.height) {
+            std::cerr << "Can't save scene to " << path << ": grid costs don't match its size\n";
+            return false;
+        }
+    }
+
+    SceneFileHeader header = {};
+    std::memcpy(header.magic, SCENE_FILE_MAGIC, sizeof(header.magic));
+    header.version = SCENE_FILE_VERSION;
+    header.prefabCount = (uint32_t)prefabs.size();
+    header.bodyCount = (uint32_t)bodies.size();
+    header.gridCount = (uint32_t)grids.size();
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write((const char*)&header, sizeof(header));
+    file.write((const char*)prefabs.data(), prefabs.size() * sizeof(ScenePrefab));
+    file.write((const char*)bodies.data(), bodies.size() * sizeof(SceneBody));
+    for (const SceneGrid& grid : grids) {
+        SceneGridHeader gridHeader = {grid.width, grid.height, grid.cellSize, 0};
+        file.write((const char*)&gridHeader, sizeof(gridHeader));
+        file.write((const char*)grid.costs.data(), grid.costs.size());
+        const char padding[4] = {};
+        file.write(padding, paddedGridBytes(grid.width, grid.height) - grid.costs.size());
+    }
+    if (!file) {
+        std::cerr << "Failed to write scene to " << path << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool MappedScene::open(const std::string& path) {
+    close();
+
+    if (!file.open(path)) {
+        std::cerr << "Failed to open scene " << path << "\n";
+        return false;
+    }
+
+    const uint8_t* data = file.getData();
+    uint64_t fileSize = file.getSize();
+    const SceneFileHeader* candidate = (const SceneFileHeader*)data;
+    bool valid = fileSize >= sizeof(SceneFileHeader) &&
+                 std::memcmp(candidate->magic, SCENE_FILE_MAGIC, sizeof(candidate->magic)) == 0 &&
+                 candidate->version == SCENE_FILE_VERSION;
+
+    // The tables must fit, then each grid in turn, ending exactly at the end
+    uint64_t offset = sizeof(SceneFileHeader);
+    if (valid) {
+        offset += (uint64_t)candidate->prefabCount * sizeof(ScenePrefab) + (uint64_t)candidate->bodyCount * sizeof(SceneBody);
+        for (uint32_t i = 0; valid && i < candidate->gridCount; i++) {
+            const SceneGridHeader* grid = (const SceneGridHeader*)(data + offset);
+            valid = offset + sizeof(SceneGridHeader) <= fileSize && grid->width > 0 && grid->height > 0;
+            if (!valid)
+                break;
+            grids.push_back(grid);
+            offset += sizeof(SceneGridHeader) + paddedGridBytes(grid->width, grid->height);
+        }
+        valid = valid && offset == fileSize;
+    }
+    if (!valid) {
+        std::cerr << "Not a scene file (or wrong version): " << path << "\n";
+        close();
+        return false;
+    }
+
+    // Sizes add up; now the prefabs must be something Box2D can build
+    const ScenePrefab* table = (const ScenePrefab*)(data + sizeof(SceneFileHeader));
+    for (uint32_t i = 0; i < candidate->prefabCount; i++) {
+        if (!isValidPrefab(table[i])) {
+            std::cerr << "Scene " << path << " has an invalid prefab " << i << "\n";
+            close();
+            return false;
+        }
+    }
+
+    header = candidate;
+    prefabs = table;
+    bodies = (const SceneBody*)(prefabs + header->prefabCount);
+    return true;
+}
+
+void MappedScene::close() {
+    file.close();
+    header = nullptr;
+    prefabs = nullptr;
+    bodies = nullptr;
+    grids.clear();
+}
+
+BodyPrefab makePrefab(const ScenePrefab& source, float scale, BodyRegistry& registry) {
+    sf::Vector2f size(source.halfWidth * 2 * scale, source.halfHeight * 2 * scale);
+    uint16_t archetype = registry.addArchetype(size, sf::Color(source.color));
+    BodyPrefab prefab = makeBoxPrefab(size, scale, (b2BodyType)source.bodyType, archetype);
+    prefab.shapeDef.density = source.density;
+    prefab.shapeDef.friction = source.friction;
+    prefab.bodyDef.linearDamping = source.linearDamping;
+    return prefab;
+}
+
+size_t spawnScene(const MappedScene& scene, b2WorldId worldId, float scale, BodyRegistry& registry, BatchLayer* staticLayer) {
+    // Two prefabs per scene prefab: awake, then asleep
+    std::vector<BodyPrefab> kinds;
+    std::vector<sf::Vector2f> sizes;
+    for (size_t i = 0; i < scene.getPrefabCount(); i++) {
+        const ScenePrefab& source = scene.getPrefabs()[i];
+        BodyPrefab kind = makePrefab(source, scale, registry);
+        kinds.push_back(kind);
+        kind.bodyDef.isAwake = false;
+        kinds.push_back(kind);
+        sizes.push_back(sf::Vector2f(source.halfWidth * 2 * scale, source.halfHeight * 2 * scale));
+    }
+
+    size_t bodyCount = scene.getBodyCount();
+    registry.reserve(registry.size() + bodyCount);
+    if (staticLayer)
+        staticLayer->reserveQuads(staticLayer->getVertexCount() / 6 + bodyCount);
+
+    size_t created = 0;
+    for (size_t i = 0; i < bodyCount; i++) {
+        const SceneBody& body = scene.getBodies()[i];
+        if (body.prefab >= scene.getPrefabCount())
+            continue;
+
+        const BodyPrefab& kind = kinds[body.prefab * 2 + ((body.flags & SCENE_BODY_ASLEEP) ? 1 : 0)];
+        b2Transform transform = {(b2Vec2){body.x, body.y}, b2MakeRot(body.angle)};
+        b2BodyId bodyId = createPrefabBody(worldId, kind, transform);
+        ++created;
+
+        // Static bodies never move, so they can be drawn from the GPU copy
+        if (staticLayer && kind.bodyDef.type == b2_staticBody) {
+            staticLayer->addQuad(sf::Vector2f(body.x * scale, body.y * scale), sizes[body.prefab], body.angle * 180.0f / b2_pi,
+                                 sf::Color(scene.getPrefabs()[body.prefab].color));
+        } else {
+            registry.create(bodyId, kind.archetype);
+        }
+    }
+    return created;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <box2d/box2d.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "BatchLayer.hpp"
+#include "BodyPrefab.hpp"
+#include "BodyRegistry.hpp"
+#include "MappedFile.hpp"
+
+// Level on disk: a fixed header, the prefab table, one 16-byte record per
+// body (static obstacles and dynamic bodies alike) and any number of cost
+// grids for flow fields, each a small header plus one byte per cell padded
+// to 4 bytes. Everything is stored in the machine's byte order, like the flow
+// field files. The magic is plain bytes and matches anywhere; a file from a
+// different-endian machine is rejected because its version reads byte-swapped.
+const char SCENE_FILE_MAGIC[4] = {'S', 'C', 'N', 'E'};
+const uint32_t SCENE_FILE_VERSION = 1;
+
+struct SceneFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t prefabCount;
+    uint32_t bodyCount;
+    uint32_t gridCount;
+    uint32_t reserved[3];
+};
+static_assert(sizeof(SceneFileHeader) == 32, "scene file header must stay 32 bytes");
+
+// One kind of box
+struct ScenePrefab {
+    float halfWidth; // Meters
+    float halfHeight;
+    float density;
+    float friction;
+    float linearDamping;
+    uint32_t color;    // sf::Color::toInteger()
+    uint32_t bodyType; // b2BodyType
+};
+static_assert(sizeof(ScenePrefab) == 28, "scene prefab must stay 28 bytes");
+
+// Body flag bits
+const uint16_t SCENE_BODY_ASLEEP = 1; // Starts asleep, e.g. a pile that has already settled
+
+struct SceneBody {
+    float x; // Meters
+    float y;
+    float angle; // Radians
+    uint16_t prefab;
+    uint16_t flags;
+};
+static_assert(sizeof(SceneBody) == 16, "scene body must stay 16 bytes");
+
+struct SceneGridHeader {
+    int32_t width;
+    int32_t height;
+    int32_t cellSize; // Pixels
+    uint32_t reserved;
+};
+static_assert(sizeof(SceneGridHeader) == 16, "scene grid header must stay 16 bytes");
+
+// A cost grid to write: row-major FlowField costs, width * height bytes
+struct SceneGrid {
+    int width = 0;
+    int height = 0;
+    int cellSize = 0;
+    std::vector<uint8_t> costs;
+};
+
+// Write a scene file. Returns false (and reports why on std::cerr) if a
+// body names a missing prefab, a grid's costs don't match its size or the
+// file can't be written.
+bool saveSceneFile(const std::string& path, const std::vector<ScenePrefab>& prefabs, const std::vector<SceneBody>& bodies,
+                   const std::vector<SceneGrid>& grids);
+
+// Read-only view of a scene file, mapped straight into memory. Opening
+// checks the header, walks the grid headers and rejects prefabs Box2D can't
+// build; body records are read in place when the scene is spawned.
+class MappedScene {
+public:
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return header != nullptr; }
+
+    size_t getPrefabCount() const { return header ? header->prefabCount : 0; }
+    const ScenePrefab* getPrefabs() const { return prefabs; }
+    size_t getBodyCount() const { return header ? header->bodyCount : 0; }
+    const SceneBody* getBodies() const { return bodies; }
+
+    // Grid i's header and its width * height cost bytes, in place
+    size_t getGridCount() const { return grids.size(); }
+    const SceneGridHeader& getGrid(size_t i) const { return *grids[i]; }
+    const uint8_t* getGridCosts(size_t i) const { return (const uint8_t*)(grids[i] + 1); }
+
+    // Bytes of the whole file, header included
+    size_t getFileSize() const { return file.getSize(); }
+
+private:
+    MappedFile file;
+    const SceneFileHeader* header = nullptr;
+    const ScenePrefab* prefabs = nullptr;
+    const SceneBody* bodies = nullptr;
+    std::vector<const SceneGridHeader*> grids;
+};
+
+// The BodyPrefab for one of a scene's prefabs (`scale` converts meters to
+// pixels), with an archetype for it added to `registry`
+BodyPrefab makePrefab(const ScenePrefab& source, float scale, BodyRegistry& registry);
+
+// Create every body of a scene through one BodyPrefab per scene prefab
+// (`scale` converts meters to pixels for their archetypes). Static bodies go
+// into `staticLayer` when given, the rest (or all) into `registry`. Bodies
+// naming a missing prefab are skipped. Returns how many bodies were created.
+size_t spawnScene(const MappedScene& scene, b2WorldId worldId, float scale, BodyRegistry& registry, BatchLayer* staticLayer);
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+
+// Thin wrappers over the widest float vector the build targets (AVX, SSE2 or
+// aarch64 NEON), so kernels are written once and compiled per ISA. When
+// none is available SIMD_LANES_ENABLED stays undefined and callers keep only
+// their scalar loop.
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#define SIMD_LANES_ENABLED 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define SIMD_LANES_ENABLED 1
+#endif
+
+namespace simd {
+
+#if defined(__AVX__)
+const unsigned LANES = 8;
+typedef __m256 Lanes;
+inline Lanes load(const float* p) { return _mm256_loadu_ps(p); }
+inline void store(float* p, Lanes v) { _mm256_storeu_ps(p, v); }
+inline Lanes splat(float v) { return _mm256_set1_ps(v); }
+inline Lanes add(Lanes a, Lanes b) { return _mm256_add_ps(a, b); }
+inline Lanes sub(Lanes a, Lanes b) { return _mm256_sub_ps(a, b); }
+inline Lanes mul(Lanes a, Lanes b) { return _mm256_mul_ps(a, b); }
+inline Lanes div(Lanes a, Lanes b) { return _mm256_div_ps(a, b); }
+inline Lanes sqrt(Lanes v) { return _mm256_sqrt_ps(v); }
+inline Lanes min(Lanes a, Lanes b) { return _mm256_min_ps(a, b); }
+inline Lanes max(Lanes a, Lanes b) { return _mm256_max_ps(a, b); }
+inline Lanes clamp(Lanes v, Lanes lo, Lanes hi) { return _mm256_max_ps(lo, _mm256_min_ps(v, hi)); }
+inline Lanes absolute(Lanes v) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v); }
+inline int lessMask(Lanes a, Lanes b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ)); }
+inline void truncate(Lanes v, int32_t* out) { _mm256_storeu_si256((__m256i*)out, _mm256_cvttps_epi32(v)); }
+#elif defined(__SSE2__)
+const unsigned LANES = 4;
+typedef __m128 Lanes;
+inline Lanes load(const float* p) { return _mm_loadu_ps(p); }
+inline void store(float* p, Lanes v) { _mm_storeu_ps(p, v); }
+inline Lanes splat(float v) { return _mm_set1_ps(v); }
+inline Lanes add(Lanes a, Lanes b) { return _mm_add_ps(a, b); }
+inline Lanes sub(Lanes a, Lanes b) { return _mm_sub_ps(a, b); }
+inline Lanes mul(Lanes a, Lanes b) { return _mm_mul_ps(a, b); }
+inline Lanes div(Lanes a, Lanes b) { return _mm_div_ps(a, b); }
+inline Lanes sqrt(Lanes v) { return _mm_sqrt_ps(v); }
+inline Lanes min(Lanes a, Lanes b) { return _mm_min_ps(a, b); }
+inline Lanes max(Lanes a, Lanes b) { return _mm_max_ps(a, b); }
+inline Lanes clamp(Lanes v, Lanes lo, Lanes hi) { return _mm_max_ps(lo, _mm_min_ps(v, hi)); }
+inline Lanes absolute(Lanes v) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), v); }
+inline int lessMask(Lanes a, Lanes b) { return _mm_movemask_ps(_mm_cmplt_ps(a, b)); }
+inline void truncate(Lanes v, int32_t* out) { _mm_storeu_si128((__m128i*)out, _mm_cvttps_epi32(v)); }
+#elif defined(SIMD_LANES_ENABLED)
+const unsigned LANES = 4;
+typedef float32x4_t Lanes;
+inline Lanes load(const float* p) { return vld1q_f32(p); }
+inline void store(float* p, Lanes v) { vst1q_f32(p, v); }
+inline Lanes splat(float v) { return vdupq_n_f32(v); }
+inline Lanes add(Lanes a, Lanes b) { return vaddq_f32(a, b); }
+inline Lanes sub(Lanes a, Lanes b) { return vsubq_f32(a, b); }
+inline Lanes mul(Lanes a, Lanes b) { return vmulq_f32(a, b); }
+inline Lanes div(Lanes a, Lanes b) { return vdivq_f32(a, b); }
+inline Lanes sqrt(Lanes v) { return vsqrtq_f32(v); }
+inline Lanes min(Lanes a, Lanes b) { return vminq_f32(a, b); }
+inline Lanes max(Lanes a, Lanes b) { return vmaxq_f32(a, b); }
+inline Lanes clamp(Lanes v, Lanes lo, Lanes hi) { return vmaxq_f32(lo, vminq_f32(v, hi)); }
+inline Lanes absolute(Lanes v) { return vabsq_f32(v); }
+inline int lessMask(Lanes a, Lanes b) {
+    const uint32_t bits[4] = {1, 2, 4, 8};
+    return (int)vaddvq_u32(vandq_u32(vcltq_f32(a, b), vld1q_u32(bits)));
+}
+inline void truncate(Lanes v, int32_t* out) { vst1q_s32(out, vcvtq_s32_f32(v)); }
+#endif
+
+} // namespace simd
@@ -0,0 +1,170 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+
+namespace {
+
+// Which pool (if any) the current thread is a worker of, and its index
+thread_local const ThreadPool* currentPool = nullptr;
+thread_local unsigned currentIndex = 0;
+
+void runFunction(size_t begin, size_t end, unsigned threadIndex, void* context) {
+    (*static_cast<const std::function<void(size_t, size_t, unsigned)>*>(context))(begin, end, threadIndex);
+}
+
+} // namespace
+
+ThreadPool::ThreadPool(unsigned threadCount) {
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned i = 0; i < threadCount; ++i) {
+        queues.emplace_back(new Queue());
+    }
+    for (unsigned i = 1; i < threadCount; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+unsigned ThreadPool::currentThreadIndex() const {
+    return currentPool == this ? currentIndex : 0;
+}
+
+void ThreadPool::parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t, unsigned)>& fn) {
+    if (count == 0)
+        return;
+    grain = std::max<size_t>(grain, 1);
+
+    // Not worth waking anyone for a single chunk
+    if (workers.empty() || count <= grain) {
+        fn(0, count, currentThreadIndex());
+        return;
+    }
+
+    TaskGroup group;
+    void* context = const_cast<void*>(static_cast<const void*>(&fn));
+    if (currentPool == this) {
+        // Nested inside a chunk: this thread already has its index
+        submit(group, count, grain, runFunction, context);
+        wait(group);
+        return;
+    }
+
+    // Outside callers all count as thread 0, so they take turns. While one
+    // waits it is thread 0 of the pool, so chunks it runs can nest calls.
+    std::lock_guard<std::mutex> submitLock(submitMutex);
+    const ThreadPool* outerPool = currentPool;
+    unsigned outerIndex = currentIndex;
+    currentPool = this;
+    currentIndex = 0;
+    submit(group, count, grain, runFunction, context);
+    wait(group);
+    currentPool = outerPool;
+    currentIndex = outerIndex;
+}
+
+void ThreadPool::submit(TaskGroup& group, size_t count, size_t grain, RangeFunction fn, void* context) {
+    if (count == 0)
+        return;
+    grain = std::max<size_t>(grain, 1);
+    size_t chunkCount = (count + grain - 1) / grain;
+
+    // Counted before they are visible, so neither the group nor the queued
+    // total can drop below zero when a thief is quick
+    group.pending.fetch_add(chunkCount, std::memory_order_relaxed);
+    queuedTasks.fetch_add(chunkCount);
+
+    size_t queueCount = queues.size();
+    unsigned first = currentThreadIndex();
+    for (size_t offset = 0; offset < std::min(queueCount, chunkCount); ++offset) {
+        Queue& queue = *queues[(first + offset) % queueCount];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        for (size_t chunk = offset; chunk < chunkCount; chunk += queueCount) {
+            size_t begin = chunk * grain;
+            queue.tasks.push_back(Task{fn, context, begin, std::min(begin + grain, count), &group});
+        }
+    }
+
+    // Taking the lock orders this with a worker checking queuedTasks
+    // before it sleeps, so the wake-up can't be missed
+    { std::lock_guard<std::mutex> lock(sleepMutex); }
+    wake.notify_all();
+}
+
+void ThreadPool::wait(TaskGroup& group) {
+    unsigned threadIndex = currentThreadIndex();
+    Task task;
+    while (!group.isDone()) {
+        if (popTask(threadIndex, task)) {
+            runTask(task, threadIndex);
+        } else {
+            // The last chunks are running elsewhere
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool ThreadPool::popTask(unsigned threadIndex, Task& task) {
+    if (queuedTasks.load(std::memory_order_relaxed) == 0)
+        return false;
+
+    // Own deque from the back: the most recently queued, likely still cached
+    {
+        Queue& own = *queues[threadIndex];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = own.tasks.back();
+            own.tasks.pop_back();
+            queuedTasks.fetch_sub(1);
+            return true;
+        }
+    }
+
+    // Steal from the front of the others', starting with the next thread
+    size_t queueCount = queues.size();
+    for (size_t offset = 1; offset < queueCount; ++offset) {
+        Queue& victim = *queues[(threadIndex + offset) % queueCount];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            queuedTasks.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::runTask(const Task& task, unsigned threadIndex) {
+    task.fn(task.begin, task.end, threadIndex, task.context);
+    task.group->pending.fetch_sub(1, std::memory_order_release);
+}
+
+void ThreadPool::workerLoop(unsigned threadIndex) {
+    currentPool = this;
+    currentIndex = threadIndex;
+
+    Task task;
+    while (true) {
+        if (popTask(threadIndex, task)) {
+            runTask(task, threadIndex);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wake.wait(lock, [this] { return stopping || queuedTasks.load() > 0; });
+        if (stopping)
+            return;
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed-size work-stealing pool for data-parallel loops and task ranges.
+// Every thread owns a deque of chunks: it pops its own from the back and,
+// once that is empty, steals from the front of the others', so uneven
+// chunks balance out without one shared queue. Only the deque being touched
+// is locked. The calling thread joins in as thread 0, so a pool of N
+// threads starts N - 1 background workers.
+class ThreadPool {
+public:
+    // fn(begin, end, threadIndex, context) for one chunk of a submitted range
+    typedef void (*RangeFunction)(size_t begin, size_t end, unsigned threadIndex, void* context);
+
+    // Outstanding chunks of one or more submits; wait() on it to finish them
+    class TaskGroup {
+    public:
+        bool isDone() const { return pending.load(std::memory_order_acquire) == 0; }
+
+    private:
+        friend class ThreadPool;
+        std::atomic<size_t> pending{0};
+    };
+
+    // threadCount 0 means one thread per hardware core
+    explicit ThreadPool(unsigned threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned getThreadCount() const { return (unsigned)workers.size() + 1; }
+
+    // Split [0, count) into chunks of at most `grain` items and run
+    // fn(begin, end, threadIndex) on them across the pool. Blocks until every
+    // chunk is done. Calls from several outside threads are serialised;
+    // calls from inside a chunk are fine and help with the work while they wait.
+    void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t, unsigned)>& fn);
+
+    // Queue [0, count) in chunks of at most `grain` without waiting. The
+    // chunks go round-robin onto the threads' deques, starting with the
+    // caller's own.
+    void submit(TaskGroup& group, size_t count, size_t grain, RangeFunction fn, void* context);
+
+    // Run queued chunks (of any group) on this thread until `group` is done
+    void wait(TaskGroup& group);
+
+private:
+    struct Task {
+        RangeFunction fn;
+        void* context;
+        size_t begin;
+        size_t end;
+        TaskGroup* group;
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void workerLoop(unsigned threadIndex);
+    bool popTask(unsigned threadIndex, Task& task);
+    void runTask(const Task& task, unsigned threadIndex);
+    unsigned currentThreadIndex() const;
+
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<Queue>> queues; // One per thread, 0 is the caller's
+    std::atomic<size_t> queuedTasks{0};         // Lets idle threads skip the locks
+
+    std::mutex submitMutex; // One outside parallelFor at a time
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    bool stopping = false;
+};
@@ -0,0 +1,57 @@
+#include "TransformSync.hpp"
+
+#include <cmath>
+
+void TransformSync::write(uint32_t slot, b2Transform transform, bool blend) {
+    if (slot >= transforms.size()) {
+        transforms.resize(slot + 1);
+        previous.resize(slot + 1);
+    }
+    RenderTransform& target = transforms[slot];
+    target.x = transform.p.x * scale;
+    target.y = transform.p.y * scale;
+    target.angle = b2Rot_GetAngle(transform.q) * 180.0f / b2_pi;
+    if (!blend)
+        previous[slot] = target;
+}
+
+void TransformSync::setSlot(uint32_t slot, b2BodyId bodyId) {
+    write(slot, b2Body_GetTransform(bodyId), false);
+}
+
+size_t TransformSync::update(b2WorldId worldId) {
+    // Slots that moved last time hold still unless they move again
+    for (uint32_t slot : moved) {
+        previous[slot] = transforms[slot];
+    }
+    moved.clear();
+
+    b2BodyEvents events = b2World_GetBodyEvents(worldId);
+    for (int i = 0; i < events.moveCount; ++i) {
+        const b2BodyMoveEvent& event = events.moveEvents[i];
+        uint32_t slot;
+        if (!slotOf(event.userData, slot))
+            continue;
+        bool known = slot < transforms.size();
+        if (known)
+            previous[slot] = transforms[slot];
+        write(slot, event.transform, known);
+        moved.push_back(slot);
+    }
+    return moved.size();
+}
+
+RenderTransform TransformSync::getInterpolated(uint32_t slot, float alpha) const {
+    const RenderTransform& from = previous[slot];
+    const RenderTransform& to = transforms[slot];
+
+    // Angles come from atan2, so take the short way round across +-180
+    float turn = to.angle - from.angle;
+    turn -= 360.0f * std::round(turn / 360.0f);
+
+    RenderTransform blended;
+    blended.x = from.x + (to.x - from.x) * alpha;
+    blended.y = from.y + (to.y - from.y) * alpha;
+    blended.angle = from.angle + turn * alpha;
+    return blended;
+}
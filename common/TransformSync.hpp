@@ -0,0 +1,64 @@
+#pragma once
+
+#include <box2d/box2d.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Render-side transform of one slot, in pixels and degrees
+struct RenderTransform {
+    float x = 0.0f;
+    float y = 0.0f;
+    float angle = 0.0f;
+};
+
+// Copies body transforms into a packed per-slot buffer from Box2D's move
+// events (b2World_GetBodyEvents) instead of polling every body. Bodies that
+// are asleep or didn't move produce no event, so a step costs O(moved
+// bodies). A body's slot lives in its user data; see slotUserData().
+class TransformSync {
+public:
+    // `scale` converts Box2D meters to pixels
+    explicit TransformSync(float scale) : scale(scale) {}
+
+    // Body user data for render slot `slot` (null user data means no slot)
+    static void* slotUserData(uint32_t slot) { return (void*)(uintptr_t)(slot + 1); }
+    static bool slotOf(void* userData, uint32_t& slot) {
+        if (!userData)
+            return false;
+        slot = (uint32_t)((uintptr_t)userData - 1);
+        return true;
+    }
+
+    // Make room for `slots` slots up front (bulk spawns)
+    void reserve(size_t slots) {
+        transforms.reserve(slots);
+        previous.reserve(slots);
+    }
+
+    // Read a body's transform into `slot` right away, for bodies moved to a
+    // new slot or teleported outside a step (no blending from the old spot)
+    void setSlot(uint32_t slot, b2BodyId bodyId);
+
+    // Apply this step's move events; call once after every b2World_Step.
+    // Returns how many slots changed.
+    size_t update(b2WorldId worldId);
+
+    // Slots written by the last update()
+    const std::vector<uint32_t>& getMovedSlots() const { return moved; }
+    const RenderTransform& getTransform(uint32_t slot) const { return transforms[slot]; }
+    size_t getSlotCount() const { return transforms.size(); }
+    float getScale() const { return scale; }
+
+    // Between the transform before and after the last update(), `alpha` of
+    // the way (GameLoop::getAlpha()); only moved slots differ from getTransform
+    RenderTransform getInterpolated(uint32_t slot, float alpha) const;
+
+private:
+    void write(uint32_t slot, b2Transform transform, bool blend);
+
+    float scale;
+    std::vector<RenderTransform> transforms;
+    std::vector<RenderTransform> previous; // Before the last update()
+    std::vector<uint32_t> moved;
+};
@@ -0,0 +1,204 @@
+#include "WorldSweep.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include "ThreadPool.hpp"
+
+namespace {
+
+// Box2D v3.0 holds at most 128 worlds at once, including the caller's own
+const unsigned MAX_SWEEP_THREADS = 64;
+
+std::mutex worldTableMutex;
+
+template <typename T>
+bool parseValues(const std::string& list, std::vector<T>& values) {
+    values.clear();
+    std::stringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        char* end = nullptr;
+        double value = std::strtod(item.c_str(), &end);
+        if (item.empty() || *end != '\0')
+            return false;
+        values.push_back((T)value);
+    }
+    return !values.empty();
+}
+
+std::string formatParams(const WorldParams& params) {
+    std::ostringstream out;
+    out << "gravity=" << params.gravity << " damping=" << params.linearDamping << " friction=" << params.friction
+        << " substeps=" << params.subStepCount;
+    return out.str();
+}
+
+double stepsPerSecond(const SweepResult& result) {
+    return result.seconds > 0.0 ? result.steps / result.seconds : 0.0;
+}
+
+struct Range {
+    double min = std::numeric_limits<double>::max();
+    double max = std::numeric_limits<double>::lowest();
+    double sum = 0.0;
+    size_t count = 0;
+
+    void add(double value) {
+        min = std::min(min, value);
+        max = std::max(max, value);
+        sum += value;
+        ++count;
+    }
+};
+
+void printRange(const std::string& name, const Range& range) {
+    std::cout << name << " min=" << range.min << " mean=" << range.sum / range.count << " max=" << range.max << "\n";
+}
+
+} // namespace
+
+bool SweepAxes::parse(const std::string& arg) {
+    size_t equals = arg.find('=');
+    if (equals == std::string::npos)
+        return false;
+
+    std::string name = arg.substr(0, equals);
+    std::string list = arg.substr(equals + 1);
+    if (name == "gravity")
+        return parseValues(list, gravity);
+    if (name == "damping")
+        return parseValues(list, linearDamping);
+    if (name == "friction")
+        return parseValues(list, friction);
+    if (name == "substeps")
+        return parseValues(list, subStepCount);
+    return false;
+}
+
+std::vector<WorldParams> SweepAxes::expand() const {
+    std::vector<WorldParams> configs;
+    configs.reserve(gravity.size() * linearDamping.size() * friction.size() * subStepCount.size());
+    for (float g : gravity) {
+        for (float damping : linearDamping) {
+            for (float f : friction) {
+                for (int subSteps : subStepCount) {
+                    configs.push_back({g, damping, f, subSteps});
+                }
+            }
+        }
+    }
+    return configs;
+}
+
+bool parseSweepOptions(int argc, char** argv, int first, SweepOptions& options) {
+    int position = 0;
+    for (int i = first; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.find('=') != std::string::npos) {
+            if (!options.axes.parse(arg)) {
+                std::cerr << "Bad sweep axis " << arg << " (gravity, damping, friction or substeps=v1,v2,...)\n";
+                return false;
+            }
+        } else if (position == 0) {
+            options.steps = std::stol(arg);
+            ++position;
+        } else if (position == 1) {
+            options.threads = (unsigned)std::stoul(arg);
+            ++position;
+        } else if (position == 2) {
+            options.csvPath = arg;
+            ++position;
+        } else {
+            std::cerr << "Unexpected sweep argument " << arg << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+int runWorldSweep(const SweepOptions& options, const std::vector<std::string>& metricNames, const SweepFunction& fn) {
+    std::vector<WorldParams> configs = options.axes.expand();
+    std::ofstream csv(options.csvPath, std::ios::trunc);
+    if (!csv) {
+        std::cerr << "Failed to open sweep CSV " << options.csvPath << "\n";
+        return 1;
+    }
+
+    unsigned threads = options.threads ? options.threads : std::thread::hardware_concurrency();
+    threads = std::max(1u, std::min(threads, MAX_SWEEP_THREADS));
+    ThreadPool pool(threads);
+
+    // One chunk per configuration, so a slow world (many substeps) doesn't
+    // hold up a batch of fast ones behind it
+    std::vector<SweepResult> results(configs.size());
+    auto start = std::chrono::steady_clock::now();
+    pool.parallelFor(configs.size(), 1, [&](size_t begin, size_t end, unsigned) {
+        for (size_t i = begin; i < end; i++) {
+            results[i].params = configs[i];
+            fn(configs[i], options.steps, results[i]);
+        }
+    });
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    csv << "gravity,linear_damping,friction,sub_steps,steps,seconds,steps_per_second";
+    for (const std::string& name : metricNames) {
+        csv << "," << name;
+    }
+    csv << "\n";
+
+    long totalSteps = 0;
+    Range rate;
+    std::vector<Range> metrics(metricNames.size());
+    const SweepResult* fastest = nullptr;
+    const SweepResult* slowest = nullptr;
+    for (const SweepResult& result : results) {
+        const WorldParams& params = result.params;
+        csv << params.gravity << "," << params.linearDamping << "," << params.friction << "," << params.subStepCount << ","
+            << result.steps << "," << result.seconds << "," << stepsPerSecond(result);
+        for (size_t m = 0; m < metricNames.size(); m++) {
+            double value = m < result.metrics.size() ? result.metrics[m] : 0.0;
+            csv << "," << value;
+            metrics[m].add(value);
+        }
+        csv << "\n";
+
+        totalSteps += result.steps;
+        rate.add(stepsPerSecond(result));
+        if (!fastest || stepsPerSecond(result) > stepsPerSecond(*fastest))
+            fastest = &result;
+        if (!slowest || stepsPerSecond(result) < stepsPerSecond(*slowest))
+            slowest = &result;
+    }
+
+    std::cout << "configs=" << configs.size() << " threads=" << threads << " steps per run=" << options.steps
+              << " wall=" << wallSeconds << "s aggregate=" << (wallSeconds > 0.0 ? totalSteps / wallSeconds : 0.0)
+              << " steps/s\n";
+    if (results.empty())
+        return 0;
+
+    printRange("world steps/s", rate);
+    for (size_t m = 0; m < metricNames.size(); m++) {
+        printRange(metricNames[m], metrics[m]);
+    }
+    std::cout << "fastest " << formatParams(fastest->params) << " steps/s=" << stepsPerSecond(*fastest) << "\n";
+    std::cout << "slowest " << formatParams(slowest->params) << " steps/s=" << stepsPerSecond(*slowest) << "\n";
+    std::cout << "wrote " << options.csvPath << "\n";
+    return csv ? 0 : 1;
+}
+
+b2WorldId createWorldLocked(const b2WorldDef& worldDef) {
+    std::lock_guard<std::mutex> lock(worldTableMutex);
+    return b2CreateWorld(&worldDef);
+}
+
+void destroyWorldLocked(b2WorldId worldId) {
+    std::lock_guard<std::mutex> lock(worldTableMutex);
+    b2DestroyWorld(worldId);
+}
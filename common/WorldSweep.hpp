@@ -0,0 +1,64 @@
+#pragma once
+
+#include <box2d/box2d.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+// The physics settings a sweep varies. Gravity points down the screen (+y).
+struct WorldParams {
+    float gravity;
+    float linearDamping; // Given to every spawned box (b2Body_SetLinearDamping)
+    float friction;      // Of the box shapes
+    int subStepCount;    // Passed to b2World_Step
+};
+
+// Values tried for each setting; every combination is one run
+struct SweepAxes {
+    std::vector<float> gravity = {1.0f, 3.0f, 6.0f, 10.0f};
+    std::vector<float> linearDamping = {0.0f, 0.5f, 2.0f, 5.0f};
+    std::vector<float> friction = {0.1f, 0.3f, 0.6f};
+    std::vector<int> subStepCount = {1, 2, 4, 8};
+
+    // Replace one axis from "name=v1,v2,..." (gravity, damping, friction or
+    // substeps); false if the name or a value doesn't parse
+    bool parse(const std::string& arg);
+
+    std::vector<WorldParams> expand() const;
+};
+
+struct SweepOptions {
+    long steps = 3600;    // Per run: a simulated minute at 60 Hz
+    unsigned threads = 0; // 0 means one per core
+    std::string csvPath = "sweep.csv";
+    SweepAxes axes;
+};
+
+// Read "[steps] [threads] [csvPath] [name=v1,v2,...]..." from argv[first]
+// on. Axis overrides may come anywhere; the rest are taken in order.
+bool parseSweepOptions(int argc, char** argv, int first, SweepOptions& options);
+
+// One finished run. The run function fills everything but `params`.
+struct SweepResult {
+    WorldParams params;
+    long steps = 0;
+    double seconds = 0.0;        // Time spent stepping, not building the world
+    std::vector<double> metrics; // In the order of the sweep's metric names
+};
+
+// Build a world with `params`, step it `steps` times and fill `result`.
+// Runs on a pool thread, so it must only touch its own world.
+typedef std::function<void(const WorldParams& params, long steps, SweepResult& result)> SweepFunction;
+
+// Run every combination of `options.axes` as its own single-threaded world,
+// one per pool thread at a time, so a sweep scales with the cores instead
+// of needing a process per configuration. Writes a CSV row per run (params,
+// steps per second, metrics) and prints the aggregate rate and the
+// min/mean/max of every metric. Returns 0 on success.
+int runWorldSweep(const SweepOptions& options, const std::vector<std::string>& metricNames, const SweepFunction& fn);
+
+// b2CreateWorld and b2DestroyWorld claim and free slots in Box2D's global
+// world table without a lock. Code that may build worlds on several threads
+// at once goes through these instead.
+b2WorldId createWorldLocked(const b2WorldDef& worldDef);
+void destroyWorldLocked(b2WorldId worldId);
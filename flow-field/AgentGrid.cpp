@@ -0,0 +1,42 @@
+#include "AgentGrid.hpp"
+
+#include <cmath>
+
+AgentGrid::AgentGrid(float worldWidth, float worldHeight, float bucketSize)
+    : invBucketSize(1.0f / bucketSize) {
+    // One extra bucket per axis so positions clamped to the far edge fit
+    bucketsX = std::max(1, (int)std::ceil(worldWidth / bucketSize) + 1);
+    bucketsY = std::max(1, (int)std::ceil(worldHeight / bucketSize) + 1);
+    cellStart.assign((size_t)bucketsX * bucketsY + 1, 0);
+}
+
+void AgentGrid::build(const float* xs, const float* ys, size_t count) {
+    agentBucket.resize(count);
+    sortedIndex.resize(count);
+    sortedX.resize(count);
+    sortedY.resize(count);
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+
+    // Count agents per bucket, shifted by one so the prefix sum gives starts
+    for (size_t i = 0; i < count; ++i) {
+        agentBucket[i] = bucketOf(xs[i], ys[i]);
+        ++cellStart[agentBucket[i] + 1];
+    }
+    for (size_t b = 1; b < cellStart.size(); ++b) {
+        cellStart[b] += cellStart[b - 1];
+    }
+
+    // Scatter (stable, so agents keep their relative order within a bucket)
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t slot = cellStart[agentBucket[i]]++;
+        sortedIndex[slot] = (uint32_t)i;
+        sortedX[slot] = xs[i];
+        sortedY[slot] = ys[i];
+    }
+
+    // The scatter advanced every start to the next bucket's start; shift back
+    for (size_t b = cellStart.size() - 1; b > 0; --b) {
+        cellStart[b] = cellStart[b - 1];
+    }
+    cellStart[0] = 0;
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Uniform spatial hash of agent positions for "neighbours within r" queries.
+// Rebuilt from scratch every frame with a counting sort, so each bucket's
+// agents end up contiguous in flat arrays (indices plus copies of their
+// positions) and a query only walks the 3x3 buckets around a point.
+class AgentGrid {
+public:
+    // bucketSize should be at least the largest query radius
+    AgentGrid(float worldWidth, float worldHeight, float bucketSize);
+
+    void build(const float* xs, const float* ys, size_t count);
+
+    // Call fn(agentIndex, dx, dy, distanceSquared) for every agent within
+    // `radius` of (x, y), dx/dy pointing from the agent to the point. Visits
+    // buckets row by row and agents in build order, so results are
+    // deterministic. Stops after `maxResults` agents.
+    template <typename Fn>
+    size_t forEachNeighbour(float x, float y, float radius, size_t maxResults, Fn fn) const;
+
+    // Call fn(agentIndex) for every agent with minX <= x <= maxX and
+    // minY <= y <= maxY, in the same order as forEachNeighbour. Only the
+    // buckets under the rectangle are visited.
+    template <typename Fn>
+    void forEachInRect(float minX, float minY, float maxX, float maxY, Fn fn) const;
+
+    // Agents in bucket order; cellStart[b] .. cellStart[b + 1] is bucket b
+    size_t size() const { return sortedIndex.size(); }
+    uint32_t getSortedIndex(size_t i) const { return sortedIndex[i]; }
+    float getSortedX(size_t i) const { return sortedX[i]; }
+    float getSortedY(size_t i) const { return sortedY[i]; }
+
+private:
+    int bucketOf(float x, float y) const {
+        int bx = std::max(0, std::min((int)(x * invBucketSize), bucketsX - 1));
+        int by = std::max(0, std::min((int)(y * invBucketSize), bucketsY - 1));
+        return by * bucketsX + bx;
+    }
+
+    float invBucketSize;
+    int bucketsX, bucketsY;
+
+    std::vector<uint32_t> cellStart; // bucketsX * bucketsY + 1 prefix sums
+    std::vector<uint32_t> agentBucket;
+    std::vector<uint32_t> sortedIndex;
+    std::vector<float> sortedX;
+    std::vector<float> sortedY;
+};
+
+template <typename Fn>
+size_t AgentGrid::forEachNeighbour(float x, float y, float radius, size_t maxResults, Fn fn) const {
+    float radiusSquared = radius * radius;
+    int minX = std::max(0, (int)((x - radius) * invBucketSize));
+    int maxX = std::min(bucketsX - 1, (int)((x + radius) * invBucketSize));
+    int minY = std::max(0, (int)((y - radius) * invBucketSize));
+    int maxY = std::min(bucketsY - 1, (int)((y + radius) * invBucketSize));
+
+    // Buckets of one row are contiguous in sorted order: one span per row
+    size_t found = 0;
+    for (int by = minY; by <= maxY; ++by) {
+        uint32_t begin = cellStart[by * bucketsX + minX];
+        uint32_t end = cellStart[by * bucketsX + maxX + 1];
+        for (uint32_t i = begin; i < end; ++i) {
+            float dx = x - sortedX[i];
+            float dy = y - sortedY[i];
+            float distanceSquared = dx * dx + dy * dy;
+            if (distanceSquared > radiusSquared)
+                continue;
+            fn(sortedIndex[i], dx, dy, distanceSquared);
+            if (++found >= maxResults)
+                return found;
+        }
+    }
+    return found;
+}
+
+template <typename Fn>
+void AgentGrid::forEachInRect(float minX, float minY, float maxX, float maxY, Fn fn) const {
+    if (maxX < minX || maxY < minY)
+        return;
+    // Same clamping as bucketOf, so agents outside the world are still found
+    int first = bucketOf(minX, minY);
+    int last = bucketOf(maxX, maxY);
+    int bucketMinX = first % bucketsX, bucketMinY = first / bucketsX;
+    int bucketMaxX = last % bucketsX, bucketMaxY = last / bucketsX;
+
+    for (int by = bucketMinY; by <= bucketMaxY; ++by) {
+        uint32_t begin = cellStart[by * bucketsX + bucketMinX];
+        uint32_t end = cellStart[by * bucketsX + bucketMaxX + 1];
+        for (uint32_t i = begin; i < end; ++i) {
+            if (sortedX[i] >= minX && sortedX[i] <= maxX && sortedY[i] >= minY && sortedY[i] <= maxY)
+                fn(sortedIndex[i]);
+        }
+    }
+}
@@ -0,0 +1,289 @@
+#include "AgentSystem.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "../common/SimdLanes.hpp"
+
+namespace {
+
+// Agents per thread-pool chunk (a multiple of every SIMD width)
+const size_t AGENT_CHUNK = 4096;
+
+// Neighbours that count towards separation; bounds the cost of dense clumps
+const size_t MAX_NEIGHBOURS = 16;
+
+#if defined(SIMD_LANES_ENABLED)
+using namespace simd;
+#endif
+
+uint64_t splitmix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+// Direction codes straight from a full FlowField
+struct GridLookup {
+    const uint8_t* directions;
+    int gridWidth, gridHeight;
+
+    uint8_t operator()(int cellX, int cellY) const {
+        if (cellX < 0 || cellX >= gridWidth || cellY < 0 || cellY >= gridHeight)
+            return DIRECTION_NONE;
+        return directions[cellY * gridWidth + cellX];
+    }
+};
+
+// Direction codes from already-built sectors (read-only, safe to share)
+struct SectorLookup {
+    const SectorFlowField* field;
+
+    uint8_t operator()(int cellX, int cellY) const { return field->getDirectionCode(cellX, cellY); }
+};
+
+// Direction codes read from a mapped field file's nibbles
+struct MappedLookup {
+    const MappedFlowField* field;
+
+    uint8_t operator()(int cellX, int cellY) const { return field->getDirectionCode(cellX, cellY); }
+};
+
+} // namespace
+
+struct AgentSystem::StepParams {
+    float invCellSize;
+    float stepX[DIRECTION_NONE + 1]; // Flow vector times -speed, per direction code
+    float stepY[DIRECTION_NONE + 1];
+    float maxX, maxY;
+    float goalX, goalY;
+    const float* separationX; // Null when separation is off
+    const float* separationY;
+};
+
+AgentSystem::AgentSystem(size_t count, float worldWidth, float worldHeight, float agentSize, uint64_t seed)
+    : xs(count), ys(count), worldWidth(worldWidth), worldHeight(worldHeight), agentSize(agentSize), seed(seed),
+      grid(worldWidth, worldHeight, agentSize) {
+    for (size_t i = 0; i < count; ++i) {
+        sf::Vector2f position = randomEdgePosition(i);
+        xs[i] = position.x;
+        ys[i] = position.y;
+    }
+}
+
+sf::Vector2f AgentSystem::randomEdgePosition(uint64_t key) const {
+    // Hash of (seed, frame, agent) so respawns don't depend on thread scheduling
+    uint64_t r = splitmix64(seed ^ splitmix64(key));
+    uint32_t along = (uint32_t)(r >> 32);
+    int w = std::max(1, (int)worldWidth);
+    int h = std::max(1, (int)worldHeight);
+
+    switch (r & 3) {
+    case 0: return sf::Vector2f(along % w, 0);           // Top
+    case 1: return sf::Vector2f(along % w, worldHeight); // Bottom
+    case 2: return sf::Vector2f(0, along % h);           // Left
+    default: return sf::Vector2f(worldWidth, along % h); // Right
+    }
+}
+
+void AgentSystem::setSeparation(float radius, float strength) {
+    separationStrength = radius > 0.f ? std::max(0.f, strength) : 0.f;
+    if (separationStrength > 0.f && radius != separationRadius) {
+        grid = AgentGrid(worldWidth, worldHeight, radius);
+        gridCurrent = false;
+    }
+    separationRadius = radius;
+}
+
+void AgentSystem::buildGrid() {
+    if (gridCurrent)
+        return;
+    grid.build(xs.data(), ys.data(), xs.size());
+    gridCurrent = true;
+}
+
+size_t AgentSystem::collectVisible(sf::FloatRect view, std::vector<uint32_t>& visible) {
+    buildGrid();
+    visible.clear();
+    // Positions are top-left corners, so a square starting up to agentSize
+    // before the view still reaches into it
+    grid.forEachInRect(view.left - agentSize, view.top - agentSize, view.left + view.width, view.top + view.height,
+                       [&](uint32_t i) { visible.push_back(i); });
+    return visible.size();
+}
+
+void AgentSystem::computeSeparation(ThreadPool& pool) {
+    buildGrid();
+    separationX.resize(xs.size());
+    separationY.resize(xs.size());
+
+    // Walk agents in bucket order so neighbouring queries share cache lines
+    pool.parallelFor(grid.size(), AGENT_CHUNK, [&](size_t begin, size_t end, unsigned) {
+        const float radius = separationRadius;
+        for (size_t k = begin; k < end; ++k) {
+            uint32_t self = grid.getSortedIndex(k);
+            float pushX = 0.f, pushY = 0.f;
+
+            // +1 because the query finds the agent itself too
+            grid.forEachNeighbour(grid.getSortedX(k), grid.getSortedY(k), radius, MAX_NEIGHBOURS + 1,
+                [&](uint32_t other, float dx, float dy, float distanceSquared) {
+                    if (other == self)
+                        return;
+                    if (distanceSquared > 0.f) {
+                        // Unit vector away from the neighbour, stronger the closer it is
+                        float distance = std::sqrt(distanceSquared);
+                        float weight = (radius - distance) / (radius * distance);
+                        pushX += dx * weight;
+                        pushY += dy * weight;
+                    } else {
+                        // Exactly on top of each other: split along x by index
+                        pushX += self < other ? -1.f : 1.f;
+                    }
+                });
+
+            float length = std::sqrt(pushX * pushX + pushY * pushY);
+            float scale = separationStrength / std::max(1.f, length);
+            separationX[self] = pushX * scale;
+            separationY[self] = pushY * scale;
+        }
+    });
+}
+
+void AgentSystem::update(const FlowField& field, sf::Vector2f goal, float speed, ThreadPool& pool) {
+    update(field, field.getLayer(), goal, speed, pool);
+}
+
+void AgentSystem::update(const FlowField& field, const FlowFieldLayer& layer, sf::Vector2f goal, float speed, ThreadPool& pool) {
+    // A layer that was never generated has no directions: nothing moves
+    GridLookup lookup = {layer.directions.data(), field.getGridWidth(), field.getGridHeight()};
+    if (layer.directions.empty())
+        lookup.gridWidth = lookup.gridHeight = 0;
+    run(lookup, field.getCellSize(), goal, speed, pool);
+}
+
+void AgentSystem::update(SectorFlowField& field, sf::Vector2f goal, float speed, ThreadPool& pool) {
+    // Lazy sector builds mutate the field, so they happen before the parallel pass
+    field.requireSectors(xs.data(), ys.data(), xs.size());
+    run(SectorLookup{&field}, field.getCellSize(), goal, speed, pool);
+}
+
+void AgentSystem::update(const MappedFlowField& field, sf::Vector2f goal, float speed, ThreadPool& pool) {
+    run(MappedLookup{&field}, field.getCellSize(), goal, speed, pool);
+}
+
+template <typename Lookup>
+void AgentSystem::run(const Lookup& lookup, int cellSize, sf::Vector2f goal, float speed, ThreadPool& pool) {
+    auto start = std::chrono::steady_clock::now();
+
+    StepParams params;
+    params.invCellSize = 1.0f / cellSize;
+    for (uint8_t code = 0; code <= DIRECTION_NONE; ++code) {
+        sf::Vector2f flow = decodeDirection(code);
+        params.stepX[code] = flow.x * -speed;
+        params.stepY[code] = flow.y * -speed;
+    }
+    params.maxX = worldWidth - agentSize;
+    params.maxY = worldHeight - agentSize;
+    params.goalX = goal.x;
+    params.goalY = goal.y;
+    params.separationX = params.separationY = nullptr;
+    if (hasSeparation()) {
+        computeSeparation(pool);
+        params.separationX = separationX.data();
+        params.separationY = separationY.data();
+    }
+
+    pool.parallelFor(xs.size(), AGENT_CHUNK, [&](size_t begin, size_t end, unsigned) {
+        updateRange(params, lookup, begin, end);
+    });
+    ++frame;
+    gridCurrent = false;
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    agentsPerSecond = seconds > 0.0 ? xs.size() / seconds : 0.0;
+}
+
+template <typename Lookup>
+void AgentSystem::updateScalar(const StepParams& params, const Lookup& lookup, size_t i) {
+    float x = xs[i];
+    float y = ys[i];
+
+    uint8_t code = lookup((int)(x * params.invCellSize), (int)(y * params.invCellSize));
+    x += params.stepX[code];
+    y += params.stepY[code];
+    if (params.separationX) {
+        x += params.separationX[i];
+        y += params.separationY[i];
+    }
+    x = std::max(0.f, std::min(x, params.maxX));
+    y = std::max(0.f, std::min(y, params.maxY));
+
+    if (std::abs(x - params.goalX) < agentSize && std::abs(y - params.goalY) < agentSize) {
+        sf::Vector2f respawn = randomEdgePosition(frame * xs.size() + i);
+        x = respawn.x;
+        y = respawn.y;
+    }
+
+    xs[i] = x;
+    ys[i] = y;
+}
+
+template <typename Lookup>
+void AgentSystem::updateRange(const StepParams& params, const Lookup& lookup, size_t begin, size_t end) {
+    size_t i = begin;
+
+#if defined(SIMD_LANES_ENABLED)
+    const Lanes invCell = splat(params.invCellSize);
+    const Lanes zero = splat(0.f);
+    const Lanes maxX = splat(params.maxX);
+    const Lanes maxY = splat(params.maxY);
+    const Lanes goalX = splat(params.goalX);
+    const Lanes goalY = splat(params.goalY);
+    const Lanes size = splat(agentSize);
+
+    alignas(32) int32_t cellX[LANES];
+    alignas(32) int32_t cellY[LANES];
+    alignas(32) float stepX[LANES];
+    alignas(32) float stepY[LANES];
+
+    for (; i + LANES <= end; i += LANES) {
+        Lanes x = load(&xs[i]);
+        Lanes y = load(&ys[i]);
+
+        // Cell lookup is a gather, so it stays scalar between the vector stages
+        truncate(mul(x, invCell), cellX);
+        truncate(mul(y, invCell), cellY);
+        for (unsigned lane = 0; lane < LANES; ++lane) {
+            uint8_t code = lookup(cellX[lane], cellY[lane]);
+            stepX[lane] = params.stepX[code];
+            stepY[lane] = params.stepY[code];
+        }
+
+        x = add(x, load(stepX));
+        y = add(y, load(stepY));
+        if (params.separationX) {
+            x = add(x, load(params.separationX + i));
+            y = add(y, load(params.separationY + i));
+        }
+        x = clamp(x, zero, maxX);
+        y = clamp(y, zero, maxY);
+        store(&xs[i], x);
+        store(&ys[i], y);
+
+        int reached = lessMask(absolute(sub(x, goalX)), size) & lessMask(absolute(sub(y, goalY)), size);
+        for (unsigned lane = 0; reached != 0 && lane < LANES; ++lane) {
+            if (!(reached & (1 << lane)))
+                continue;
+            sf::Vector2f respawn = randomEdgePosition(frame * xs.size() + i + lane);
+            xs[i + lane] = respawn.x;
+            ys[i + lane] = respawn.y;
+        }
+    }
+#endif
+
+    for (; i < end; ++i) {
+        updateScalar(params, lookup, i);
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "AgentGrid.hpp"
+#include "FlowField.hpp"
+#include "FlowFieldFile.hpp"
+#include "SectorFlowField.hpp"
+#include "../common/ThreadPool.hpp"
+
+// Crowd of flow-field agents stored as separate x/y float arrays. Each update
+// looks up the flow direction, moves, clamps to the world and respawns agents
+// that reached the goal, in SIMD batches spread over a thread pool. With
+// separation on, a parallel neighbour pass over an AgentGrid first pushes
+// agents apart; it reads the grid's copy of last frame's positions, so the
+// result doesn't depend on thread count.
+class AgentSystem {
+public:
+    AgentSystem(size_t count, float worldWidth, float worldHeight, float agentSize, uint64_t seed);
+
+    // Advance every agent one step of `speed` pixels against the flow
+    void update(const FlowField& field, sf::Vector2f goal, float speed, ThreadPool& pool);
+
+    // Same, following one layer of the field (e.g. a squad's cached field)
+    void update(const FlowField& field, const FlowFieldLayer& layer, sf::Vector2f goal, float speed, ThreadPool& pool);
+
+    // Same, following a sectored field; sectors agents stand in are built first
+    void update(SectorFlowField& field, sf::Vector2f goal, float speed, ThreadPool& pool);
+
+    // Same, reading a precomputed field file in place
+    void update(const MappedFlowField& field, sf::Vector2f goal, float speed, ThreadPool& pool);
+
+    // Push agents within `radius` of each other apart by up to `strength`
+    // pixels per step; strength 0 turns separation off
+    void setSeparation(float radius, float strength);
+    bool hasSeparation() const { return separationStrength > 0.f; }
+
+    size_t size() const { return xs.size(); }
+    const float* getX() const { return xs.data(); }
+    const float* getY() const { return ys.data(); }
+    sf::Vector2f getPosition(size_t i) const { return sf::Vector2f(xs[i], ys[i]); }
+
+    // Indices of the agents whose square overlaps `view` (pixels, e.g.
+    // Camera::getVisibleRect()), looked up in the AgentGrid. The grid is
+    // rebuilt at most once per update and then shared with the next
+    // update's separation pass, so culling adds no rebuild while separation
+    // is on.
+    size_t collectVisible(sf::FloatRect view, std::vector<uint32_t>& visible);
+
+    // Throughput of the last update call
+    double getAgentsPerSecond() const { return agentsPerSecond; }
+
+private:
+    struct StepParams;
+
+    template <typename Lookup>
+    void run(const Lookup& lookup, int cellSize, sf::Vector2f goal, float speed, ThreadPool& pool);
+    template <typename Lookup>
+    void updateRange(const StepParams& params, const Lookup& lookup, size_t begin, size_t end);
+    template <typename Lookup>
+    void updateScalar(const StepParams& params, const Lookup& lookup, size_t i);
+    sf::Vector2f randomEdgePosition(uint64_t key) const;
+    void computeSeparation(ThreadPool& pool);
+    void buildGrid();
+
+    std::vector<float> xs;
+    std::vector<float> ys;
+    float worldWidth, worldHeight, agentSize;
+    uint64_t seed;
+
+    AgentGrid grid;
+    bool gridCurrent = false; // Built from the positions as they are now
+    float separationRadius = 0.f;
+    float separationStrength = 0.f;
+    std::vector<float> separationX; // Per-agent push for the next step
+    std::vector<float> separationY;
+
+    uint64_t frame = 0;
+    double agentsPerSecond = 0.0;
+};
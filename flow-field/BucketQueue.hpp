@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "FlowField.hpp"
+
+// Dial's bucket queue for flood fills. Edge weights are small integers, so a
+// ring of maxStep + 1 buckets replaces a binary heap. Every pending distance
+// must lie within maxStep of the last popped one, which holds for a flood
+// from a single seed. Entries may be stale; callers compare the popped
+// distance against their own distance array.
+class BucketQueue {
+public:
+    explicit BucketQueue(uint32_t maxStep = (OBSTACLE_COST - 1) * DIAGONAL_STEP) : buckets(maxStep + 1) {}
+
+    void reset(uint32_t start = 0) {
+        // A drained queue has nothing left in its buckets
+        if (count != 0) {
+            for (auto& bucket : buckets) {
+                bucket.clear();
+            }
+        }
+        current = start;
+        count = 0;
+    }
+
+    void push(uint32_t dist, uint32_t cell) {
+        buckets[dist % buckets.size()].push_back(cell);
+        ++count;
+    }
+
+    bool empty() const { return count == 0; }
+    uint32_t getMaxStep() const { return (uint32_t)buckets.size() - 1; }
+
+    uint32_t pop(uint32_t& dist) {
+        std::vector<uint32_t>* bucket = &buckets[current % buckets.size()];
+        while (bucket->empty()) {
+            ++current;
+            bucket = &buckets[current % buckets.size()];
+        }
+        uint32_t cell = bucket->back();
+        bucket->pop_back();
+        --count;
+        dist = current;
+        return cell;
+    }
+
+private:
+    std::vector<std::vector<uint32_t>> buckets;
+    uint32_t current = 0;
+    size_t count = 0;
+};
@@ -0,0 +1,465 @@
+#include "FlowField.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <unordered_set>
+#include <utility>
+#include "BucketQueue.hpp"
+
+const sf::Vector2i DIRECTION_OFFSETS[DIRECTION_COUNT] = {
+    sf::Vector2i(0, -1),  // Up
+    sf::Vector2i(1, 0),   // Right
+    sf::Vector2i(0, 1),   // Down
+    sf::Vector2i(-1, 0),  // Left
+    sf::Vector2i(1, -1),  // Up-right
+    sf::Vector2i(1, 1),   // Down-right
+    sf::Vector2i(-1, 1),  // Down-left
+    sf::Vector2i(-1, -1)  // Up-left
+};
+
+namespace {
+
+const float DIAGONAL = 0.70710678f;
+
+const sf::Vector2f DIRECTION_VECTORS[DIRECTION_COUNT + 1] = {
+    sf::Vector2f(0, -1), sf::Vector2f(1, 0), sf::Vector2f(0, 1), sf::Vector2f(-1, 0),
+    sf::Vector2f(DIAGONAL, -DIAGONAL), sf::Vector2f(DIAGONAL, DIAGONAL),
+    sf::Vector2f(-DIAGONAL, DIAGONAL), sf::Vector2f(-DIAGONAL, -DIAGONAL),
+    sf::Vector2f(0, 0) // DIRECTION_NONE
+};
+
+} // namespace
+
+sf::Vector2f decodeDirection(uint8_t code) {
+    return DIRECTION_VECTORS[std::min(code, DIRECTION_NONE)];
+}
+
+uint8_t oppositeDirection(uint8_t code) {
+    if (code >= DIRECTION_COUNT)
+        return DIRECTION_NONE;
+    return code < 4 ? (code + 2) % 4 : 4 + (code - 4 + 2) % 4;
+}
+
+FlowField::FlowField(int width, int height, int cellSize)
+    : width(width), height(height), cellSize(cellSize) {
+    // Calculate number of cells in each dimension
+    gridWidth = width / cellSize;
+    gridHeight = height / cellSize;
+
+    costs.assign((size_t)gridWidth * gridHeight, DEFAULT_COST);
+}
+
+void FlowField::generateFlowField(sf::Vector2f goal) {
+    generateInto(activeLayer, goal);
+}
+
+void FlowField::generateInto(FlowFieldLayer& layer, sf::Vector2f goal) const {
+    generateForCell(layer, cellIndexAt(goal), mode);
+}
+
+void FlowField::generateForCell(FlowFieldLayer& layer, int goalCell, FlowFieldMode layerMode) const {
+    // Reset all cells
+    layer.integration.assign(costs.size(), UNREACHABLE);
+    layer.directions.assign(costs.size(), DIRECTION_NONE);
+    layer.goalCell = goalCell;
+    layer.mode = layerMode;
+    layer.obstacleVersion = obstacleVersion;
+
+    if (layerMode == FlowFieldMode::Bfs) {
+        floodBfs(layer);
+    } else {
+        floodWeighted(layer);
+        buildDirections(layer);
+    }
+}
+
+uint64_t FlowField::getCostHash() const {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (uint8_t cost : costs) {
+        hash = (hash ^ cost) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+int FlowField::cellIndexAt(sf::Vector2f position) const {
+    int cellX = std::max(0, std::min((int)(position.x / cellSize), gridWidth - 1));
+    int cellY = std::max(0, std::min((int)(position.y / cellSize), gridHeight - 1));
+    return index(cellX, cellY);
+}
+
+void FlowField::floodBfs(FlowFieldLayer& layer) const {
+    std::vector<uint32_t>& integration = layer.integration;
+    std::vector<uint8_t>& directions = layer.directions;
+    int goal = layer.goalCell;
+
+    // Every cell is enqueued at most once, so a flat array is the whole queue
+    std::vector<uint32_t> queue(costs.size());
+    size_t head = 0, tail = 0;
+
+    queue[tail++] = goal;
+    integration[goal] = 0;
+
+    while (head < tail) {
+        uint32_t current = queue[head++];
+        int x = current % gridWidth;
+        int y = current / gridWidth;
+
+        // For each direction (up, right, down, left)
+        for (uint8_t d = 0; d < 4; ++d) {
+            int nx = x + DIRECTION_OFFSETS[d].x;
+            int ny = y + DIRECTION_OFFSETS[d].y;
+            if (!inBounds(nx, ny))
+                continue;
+
+            int neighbor = index(nx, ny);
+            if (integration[neighbor] != UNREACHABLE || costs[neighbor] == OBSTACLE_COST)
+                continue;
+
+            // Point from the current cell to the neighbor, as the original BFS did
+            integration[neighbor] = integration[current] + 1;
+            directions[neighbor] = d;
+            queue[tail++] = neighbor;
+        }
+    }
+}
+
+void FlowField::floodWeighted(FlowFieldLayer& layer) const {
+    std::vector<uint32_t>& integration = layer.integration;
+    int goal = layer.goalCell;
+
+    BucketQueue queue;
+    integration[goal] = 0;
+    queue.push(0, goal);
+
+    while (!queue.empty()) {
+        uint32_t dist;
+        uint32_t current = queue.pop(dist);
+        if (dist != integration[current])
+            continue; // Stale entry
+
+        int x = current % gridWidth;
+        int y = current / gridWidth;
+
+        for (uint8_t d = 0; d < DIRECTION_COUNT; ++d) {
+            int nx = x + DIRECTION_OFFSETS[d].x;
+            int ny = y + DIRECTION_OFFSETS[d].y;
+            if (!inBounds(nx, ny))
+                continue;
+
+            int neighbor = index(nx, ny);
+            uint8_t cost = costs[neighbor];
+            if (cost == OBSTACLE_COST)
+                continue;
+
+            uint32_t step = STRAIGHT_STEP;
+            if (d >= 4) {
+                // No cutting corners past obstacles
+                if (costs[index(nx, y)] == OBSTACLE_COST || costs[index(x, ny)] == OBSTACLE_COST)
+                    continue;
+                step = DIAGONAL_STEP;
+            }
+
+            uint32_t candidate = dist + cost * step;
+            if (candidate < integration[neighbor]) {
+                integration[neighbor] = candidate;
+                queue.push(candidate, neighbor);
+            }
+        }
+    }
+}
+
+void FlowField::buildDirections(FlowFieldLayer& layer) const {
+    for (int y = 0; y < gridHeight; ++y) {
+        for (int x = 0; x < gridWidth; ++x) {
+            layer.directions[index(x, y)] = downhillDirection(layer, x, y);
+        }
+    }
+}
+
+uint8_t FlowField::downhillDirection(const FlowFieldLayer& layer, int x, int y) const {
+    uint32_t best = layer.integration[index(x, y)];
+    if (best == UNREACHABLE || best == 0)
+        return DIRECTION_NONE;
+
+    uint8_t bestDir = DIRECTION_NONE;
+    for (uint8_t d = 0; d < DIRECTION_COUNT; ++d) {
+        int nx = x + DIRECTION_OFFSETS[d].x;
+        int ny = y + DIRECTION_OFFSETS[d].y;
+        if (!inBounds(nx, ny))
+            continue;
+        if (d >= 4 && (costs[index(nx, y)] == OBSTACLE_COST || costs[index(x, ny)] == OBSTACLE_COST))
+            continue;
+
+        uint32_t value = layer.integration[index(nx, ny)];
+        if (value < best) {
+            best = value;
+            bestDir = d;
+        }
+    }
+
+    // Stored direction points from the downhill neighbour back to this cell
+    return oppositeDirection(bestDir);
+}
+
+uint32_t FlowField::stepCost(int fromX, int fromY, uint8_t d, FlowFieldMode layerMode) const {
+    int nx = fromX + DIRECTION_OFFSETS[d].x;
+    int ny = fromY + DIRECTION_OFFSETS[d].y;
+    if (!inBounds(nx, ny) || costs[index(nx, ny)] == OBSTACLE_COST)
+        return UNREACHABLE;
+
+    if (layerMode == FlowFieldMode::Bfs)
+        return d < 4 ? 1 : UNREACHABLE;
+    if (d < 4)
+        return costs[index(nx, ny)] * STRAIGHT_STEP;
+    if (costs[index(nx, fromY)] == OBSTACLE_COST || costs[index(fromX, ny)] == OBSTACLE_COST)
+        return UNREACHABLE;
+    return costs[index(nx, ny)] * DIAGONAL_STEP;
+}
+
+size_t FlowField::changeCost(int x, int y, uint8_t cost, FlowFieldLayer& layer) {
+    if (!inBounds(x, y))
+        return 0;
+
+    bool current = layer.obstacleVersion == obstacleVersion && !layer.integration.empty();
+    uint8_t oldCost = costs[index(x, y)];
+    setCost(x, y, cost);
+    if (!current)
+        return 0;
+
+    layer.obstacleVersion = obstacleVersion;
+    return repairLayer(layer, index(x, y), oldCost);
+}
+
+size_t FlowField::repairLayer(FlowFieldLayer& layer, int changed, uint8_t oldCost) const {
+    typedef std::pair<uint32_t, int> Entry; // (distance, cell)
+    typedef std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> MinHeap;
+
+    std::vector<uint32_t>& integration = layer.integration;
+    uint8_t newCost = costs[changed];
+    bool bfs = layer.mode == FlowFieldMode::Bfs;
+    uint8_t directionCount = bfs ? 4 : DIRECTION_COUNT;
+    bool wasBlocked = oldCost == OBSTACLE_COST, isBlocked = newCost == OBSTACLE_COST;
+
+    // BFS distances only care whether a cell is blocked
+    if (newCost == oldCost || (bfs && wasBlocked == isBlocked))
+        return 0;
+
+    int changedX = changed % gridWidth, changedY = changed / gridWidth;
+    std::unordered_set<int> invalid;
+    std::unordered_set<int> touched;
+
+    // Best distance a cell can get from neighbours that are still valid
+    auto bestFromNeighbours = [&](int cell) {
+        if (cell == layer.goalCell)
+            return 0u;
+        uint32_t best = UNREACHABLE;
+        int x = cell % gridWidth, y = cell / gridWidth;
+        for (uint8_t d = 0; d < directionCount; ++d) {
+            int px = x + DIRECTION_OFFSETS[d].x, py = y + DIRECTION_OFFSETS[d].y;
+            if (!inBounds(px, py))
+                continue;
+            uint32_t from = integration[index(px, py)];
+            if (from == UNREACHABLE || invalid.count(index(px, py)))
+                continue;
+            uint32_t step = stepCost(px, py, oppositeDirection(d), layer.mode);
+            if (step != UNREACHABLE)
+                best = std::min(best, from + step);
+        }
+        return best;
+    };
+
+    // Phase 1: a cost went up, so find the cells whose old distance no longer
+    // has a valid predecessor. Checked in increasing distance order, every
+    // predecessor of a cell has been decided before the cell itself.
+    if (newCost > oldCost) {
+        MinHeap check;
+        if (integration[changed] != UNREACHABLE)
+            check.push(Entry(integration[changed], changed));
+        if (isBlocked && !bfs) {
+            // Diagonal steps past the new obstacle are now cut
+            for (uint8_t d = 0; d < 4; ++d) {
+                int nx = changedX + DIRECTION_OFFSETS[d].x, ny = changedY + DIRECTION_OFFSETS[d].y;
+                if (inBounds(nx, ny) && integration[index(nx, ny)] != UNREACHABLE)
+                    check.push(Entry(integration[index(nx, ny)], index(nx, ny)));
+            }
+        }
+
+        while (!check.empty()) {
+            Entry top = check.top();
+            check.pop();
+            int cell = top.second;
+            if (invalid.count(cell) || (costs[cell] != OBSTACLE_COST && bestFromNeighbours(cell) == top.first))
+                continue;
+            if (cell == layer.goalCell)
+                continue;
+
+            invalid.insert(cell);
+            int x = cell % gridWidth, y = cell / gridWidth;
+            for (uint8_t d = 0; d < directionCount; ++d) {
+                int nx = x + DIRECTION_OFFSETS[d].x, ny = y + DIRECTION_OFFSETS[d].y;
+                if (!inBounds(nx, ny))
+                    continue;
+                uint32_t value = integration[index(nx, ny)];
+                if (value != UNREACHABLE && value > top.first && !invalid.count(index(nx, ny)))
+                    check.push(Entry(value, index(nx, ny)));
+            }
+        }
+    }
+
+    // Phase 2: seed the invalidated cells (and, for a cost drop, the changed
+    // cell and the diagonals it unblocked) from the valid boundary, then let
+    // improvements spread with a local Dijkstra
+    std::vector<int> seeds(invalid.begin(), invalid.end());
+    if (newCost < oldCost) {
+        seeds.push_back(changed);
+        if (wasBlocked && !bfs) {
+            for (uint8_t d = 0; d < 4; ++d) {
+                int nx = changedX + DIRECTION_OFFSETS[d].x, ny = changedY + DIRECTION_OFFSETS[d].y;
+                if (inBounds(nx, ny))
+                    seeds.push_back(index(nx, ny));
+            }
+        }
+    }
+
+    for (int cell : invalid) {
+        integration[cell] = UNREACHABLE;
+    }
+    invalid.clear();
+
+    MinHeap open;
+    for (int cell : seeds) {
+        if (costs[cell] == OBSTACLE_COST && cell != layer.goalCell) {
+            touched.insert(cell);
+            continue;
+        }
+        uint32_t best = bestFromNeighbours(cell);
+        if (best < integration[cell] || integration[cell] == UNREACHABLE) {
+            integration[cell] = best;
+            touched.insert(cell);
+            if (best != UNREACHABLE)
+                open.push(Entry(best, cell));
+        }
+    }
+
+    while (!open.empty()) {
+        Entry top = open.top();
+        open.pop();
+        if (top.first != integration[top.second])
+            continue; // Stale entry
+
+        int x = top.second % gridWidth, y = top.second / gridWidth;
+        for (uint8_t d = 0; d < directionCount; ++d) {
+            uint32_t step = stepCost(x, y, d, layer.mode);
+            if (step == UNREACHABLE)
+                continue;
+            int neighbor = index(x + DIRECTION_OFFSETS[d].x, y + DIRECTION_OFFSETS[d].y);
+            if (top.first + step < integration[neighbor]) {
+                integration[neighbor] = top.first + step;
+                touched.insert(neighbor);
+                open.push(Entry(integration[neighbor], neighbor));
+            }
+        }
+    }
+
+    // Phase 3: directions of every cell next to a changed distance (or to the
+    // changed cell, for the corner rule). Weighted directions follow the
+    // steepest neighbour; BFS keeps its parent while it's still one step
+    // downhill, since a cell with an equally close alternative parent was
+    // never invalidated.
+    std::unordered_set<int> redo(touched);
+    redo.insert(changed);
+    std::vector<int> around(redo.begin(), redo.end());
+    for (int cell : around) {
+        int x = cell % gridWidth, y = cell / gridWidth;
+        for (uint8_t d = 0; d < directionCount; ++d) {
+            int nx = x + DIRECTION_OFFSETS[d].x, ny = y + DIRECTION_OFFSETS[d].y;
+            if (inBounds(nx, ny))
+                redo.insert(index(nx, ny));
+        }
+    }
+
+    for (int cell : redo) {
+        int x = cell % gridWidth, y = cell / gridWidth;
+        if (!bfs) {
+            layer.directions[cell] = downhillDirection(layer, x, y);
+            continue;
+        }
+
+        uint32_t value = integration[cell];
+        uint8_t& direction = layer.directions[cell];
+        if (value == UNREACHABLE || value == 0) {
+            direction = DIRECTION_NONE;
+            continue;
+        }
+        if (direction != DIRECTION_NONE) {
+            int px = x - DIRECTION_OFFSETS[direction].x, py = y - DIRECTION_OFFSETS[direction].y;
+            if (inBounds(px, py) && integration[index(px, py)] + 1 == value)
+                continue;
+        }
+        direction = DIRECTION_NONE;
+        for (uint8_t d = 0; d < 4 && direction == DIRECTION_NONE; ++d) {
+            int px = x + DIRECTION_OFFSETS[d].x, py = y + DIRECTION_OFFSETS[d].y;
+            if (inBounds(px, py) && integration[index(px, py)] + 1 == value)
+                direction = oppositeDirection(d);
+        }
+    }
+
+    return touched.size();
+}
+
+size_t FlowField::verifyLayer(const FlowFieldLayer& layer) const {
+    FlowFieldLayer rebuilt;
+    generateForCell(rebuilt, layer.goalCell, layer.mode);
+
+    size_t mismatches = 0;
+    for (int cell = 0; cell < (int)costs.size(); ++cell) {
+        if (layer.integration[cell] != rebuilt.integration[cell]) {
+            ++mismatches;
+        } else if (layer.mode == FlowFieldMode::Weighted) {
+            mismatches += layer.directions[cell] != rebuilt.directions[cell];
+        } else if (layer.directions[cell] != rebuilt.directions[cell]) {
+            // Either parent is fine as long as it's one step closer
+            uint8_t direction = layer.directions[cell];
+            int px = cell % gridWidth - (direction < DIRECTION_COUNT ? DIRECTION_OFFSETS[direction].x : 0);
+            int py = cell / gridWidth - (direction < DIRECTION_COUNT ? DIRECTION_OFFSETS[direction].y : 0);
+            bool valid = direction < 4 && inBounds(px, py) && layer.integration[index(px, py)] + 1 == layer.integration[cell];
+            mismatches += !valid;
+        }
+    }
+    return mismatches;
+}
+
+void FlowField::setObstacle(int x, int y) {
+    setCost(x, y, OBSTACLE_COST);
+}
+
+void FlowField::setCost(int x, int y, uint8_t cost) {
+    if (inBounds(x, y) && costs[index(x, y)] != std::max(cost, DEFAULT_COST)) {
+        costs[index(x, y)] = std::max(cost, DEFAULT_COST);
+        ++obstacleVersion;
+    }
+}
+
+uint8_t FlowField::getCost(int x, int y) const {
+    return inBounds(x, y) ? costs[index(x, y)] : OBSTACLE_COST;
+}
+
+sf::Vector2f FlowField::getFlowDirection(sf::Vector2f position) const {
+    return getFlowDirection(activeLayer, position);
+}
+
+sf::Vector2f FlowField::getFlowDirection(const FlowFieldLayer& layer, sf::Vector2f position) const {
+    int cellX = position.x / cellSize;
+    int cellY = position.y / cellSize;
+
+    // Make sure we don't go out of bounds
+    if (!inBounds(cellX, cellY) || layer.directions.empty())
+        return sf::Vector2f(0, 0); // Return zero if out of bounds
+
+    return decodeDirection(layer.directions[index(cellX, cellY)]);
+}
+
+uint32_t FlowField::getIntegration(int x, int y) const {
+    return inBounds(x, y) && !activeLayer.integration.empty() ? activeLayer.integration[index(x, y)] : UNREACHABLE;
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+// How generateFlowField integrates distances from the goal
+enum class FlowFieldMode {
+    Bfs,      // Unweighted 4-way flood (ignores traversal costs)
+    Weighted  // Dijkstra over per-cell traversal costs, 8-way
+};
+
+// Traversal cost of an ordinary cell; OBSTACLE_COST marks a blocked cell
+const uint8_t DEFAULT_COST = 1;
+const uint8_t OBSTACLE_COST = 255;
+
+// Packed direction codes: 0-3 are up/right/down/left, 4-7 the diagonals
+// (up-right, down-right, down-left, up-left) and DIRECTION_NONE means no flow
+const uint8_t DIRECTION_NONE = 8;
+const uint8_t DIRECTION_COUNT = 8;
+
+// Integration value of cells the goal cannot reach
+const uint32_t UNREACHABLE = 0xFFFFFFFFu;
+
+// Weighted mode step costs (fixed point, x10 so diagonals stay integral)
+const uint32_t STRAIGHT_STEP = 10;
+const uint32_t DIAGONAL_STEP = 14;
+
+// Grid offset for each packed direction code
+extern const sf::Vector2i DIRECTION_OFFSETS[DIRECTION_COUNT];
+
+// Flow vector for a packed direction code (zero for DIRECTION_NONE)
+sf::Vector2f decodeDirection(uint8_t code);
+
+// Code of the direction pointing the other way
+uint8_t oppositeDirection(uint8_t code);
+
+// Output of one flow field generation. Layers are plain values, so several
+// goals can be generated side by side over the same costs and kept around.
+struct FlowFieldLayer {
+    int goalCell = -1;
+    FlowFieldMode mode = FlowFieldMode::Bfs;
+    uint64_t obstacleVersion = 0;      // FlowField version the layer was built from
+    std::vector<uint32_t> integration; // Row-major, UNREACHABLE where blocked
+    std::vector<uint8_t> directions;   // Row-major packed direction codes
+};
+
+// Flow Field Class
+//
+// Cells live in flat row-major arrays (index = y * gridWidth + x), one array
+// per attribute, so the flood only touches the bytes it needs. The stored
+// direction of a cell points away from the goal, the same convention as the
+// original BFS: agents move along -getFlowDirection().
+class FlowField {
+public:
+    FlowField(int width, int height, int cellSize);
+
+    // Generate the flow field based on a given goal position
+    void generateFlowField(sf::Vector2f goal);
+
+    // Generate a field for a goal into a separate layer. Only reads the costs,
+    // so calls for different layers may run on several threads at once.
+    void generateInto(FlowFieldLayer& layer, sf::Vector2f goal) const;
+
+    void setMode(FlowFieldMode newMode) { mode = newMode; }
+    FlowFieldMode getMode() const { return mode; }
+
+    // Set a cell as an obstacle
+    void setObstacle(int x, int y);
+
+    // Set the traversal cost of a cell (1 = open ground, OBSTACLE_COST = blocked)
+    void setCost(int x, int y, uint8_t cost);
+    uint8_t getCost(int x, int y) const;
+
+    // Runtime cost changes that repair a generated layer in place instead of
+    // regenerating it. Only cells whose distance actually depends on the
+    // change are re-flooded; the return value is how many cells were touched.
+    // The layer must be up to date with the costs before the change,
+    // otherwise only the cost is updated and 0 is returned.
+    size_t changeCost(int x, int y, uint8_t cost, FlowFieldLayer& layer);
+    size_t changeCost(int x, int y, uint8_t cost) { return changeCost(x, y, cost, activeLayer); }
+    size_t addObstacle(int x, int y) { return changeCost(x, y, OBSTACLE_COST); }
+    size_t removeObstacle(int x, int y) { return changeCost(x, y, DEFAULT_COST); }
+
+    // Regenerate the layer's goal from scratch and count cells that differ.
+    // Weighted layers must match exactly; BFS layers must match distances and
+    // every direction must lead one step downhill (ties may resolve differently).
+    size_t verifyLayer(const FlowFieldLayer& layer) const;
+
+    // Get the flow direction at a specific position
+    sf::Vector2f getFlowDirection(sf::Vector2f position) const;
+    sf::Vector2f getFlowDirection(const FlowFieldLayer& layer, sf::Vector2f position) const;
+
+    // Distance to the goal from the last generation, UNREACHABLE if none
+    uint32_t getIntegration(int x, int y) const;
+
+    // Row-major packed direction codes, for batched lookups. Null until the
+    // first generateFlowField, so worlds that only use sectored fields never
+    // pay for the full-size arrays.
+    const uint8_t* getDirectionData() const { return activeLayer.directions.empty() ? nullptr : activeLayer.directions.data(); }
+    const uint8_t* getCostData() const { return costs.data(); }
+
+    // Layer written by generateFlowField
+    const FlowFieldLayer& getLayer() const { return activeLayer; }
+
+    // Bumped by every cost change; layers from older versions are stale
+    uint64_t getObstacleVersion() const { return obstacleVersion; }
+
+    // FNV-1a hash of every cell cost, stable across runs (saved fields use it
+    // to tell whether they were baked from this map)
+    uint64_t getCostHash() const;
+
+    // Cell index of a position, clamped to the grid
+    int cellIndexAt(sf::Vector2f position) const;
+
+    int getGridWidth() const { return gridWidth; }
+    int getGridHeight() const { return gridHeight; }
+    int getCellSize() const { return cellSize; }
+
+private:
+    int index(int x, int y) const { return y * gridWidth + x; }
+    bool inBounds(int x, int y) const { return x >= 0 && x < gridWidth && y >= 0 && y < gridHeight; }
+
+    void generateForCell(FlowFieldLayer& layer, int goalCell, FlowFieldMode layerMode) const;
+    void floodBfs(FlowFieldLayer& layer) const;
+    void floodWeighted(FlowFieldLayer& layer) const;
+    void buildDirections(FlowFieldLayer& layer) const;
+
+    // Cost of a step from (fromX, fromY) to its neighbour in direction d, the
+    // neighbour being the cell further from the goal; UNREACHABLE if not allowed
+    uint32_t stepCost(int fromX, int fromY, uint8_t d, FlowFieldMode layerMode) const;
+    uint8_t downhillDirection(const FlowFieldLayer& layer, int x, int y) const;
+    size_t repairLayer(FlowFieldLayer& layer, int changed, uint8_t oldCost) const;
+
+    int width, height, cellSize;
+    int gridWidth, gridHeight;
+    FlowFieldMode mode = FlowFieldMode::Bfs;
+    uint64_t obstacleVersion = 0;
+
+    std::vector<uint8_t> costs;
+    FlowFieldLayer activeLayer;
+};
@@ -0,0 +1,98 @@
+#include "FlowFieldCache.hpp"
+
+#include <algorithm>
+
+FlowFieldCache::FlowFieldCache(const FlowField& field, size_t capacity)
+    : field(field), capacity(std::max<size_t>(capacity, 1)) {
+}
+
+FlowFieldCache::Key FlowFieldCache::keyFor(sf::Vector2f goal) const {
+    return Key{field.cellIndexAt(goal), field.getMode(), field.getObstacleVersion()};
+}
+
+std::shared_ptr<const FlowFieldLayer> FlowFieldCache::find(const Key& key) {
+    // Costs changed: nothing cached can be hit again
+    if (key.obstacleVersion != cachedVersion) {
+        clear();
+        cachedVersion = key.obstacleVersion;
+    }
+
+    auto it = index.find(key);
+    if (it == index.end())
+        return nullptr;
+
+    entries.splice(entries.begin(), entries, it->second);
+    return it->second->layer;
+}
+
+void FlowFieldCache::insert(const Key& key, std::shared_ptr<const FlowFieldLayer> layer) {
+    entries.push_front(Entry{key, std::move(layer)});
+    index[key] = entries.begin();
+
+    while (entries.size() > capacity) {
+        index.erase(entries.back().key);
+        entries.pop_back();
+    }
+}
+
+std::shared_ptr<const FlowFieldLayer> FlowFieldCache::get(sf::Vector2f goal) {
+    Key key = keyFor(goal);
+    std::shared_ptr<const FlowFieldLayer> layer = find(key);
+    if (layer) {
+        ++hits;
+        return layer;
+    }
+
+    ++misses;
+    auto generated = std::make_shared<FlowFieldLayer>();
+    field.generateInto(*generated, goal);
+    insert(key, generated);
+    return generated;
+}
+
+std::vector<std::shared_ptr<const FlowFieldLayer>> FlowFieldCache::getBatch(const std::vector<sf::Vector2f>& goals, ThreadPool& pool) {
+    std::vector<std::shared_ptr<const FlowFieldLayer>> result(goals.size());
+
+    // Collect distinct misses; squads sharing a goal cell share one generation
+    std::vector<Key> missKeys;
+    std::vector<sf::Vector2f> missGoals;
+    std::vector<size_t> missOf(goals.size(), SIZE_MAX);
+    for (size_t i = 0; i < goals.size(); ++i) {
+        Key key = keyFor(goals[i]);
+        result[i] = find(key);
+        if (result[i]) {
+            ++hits;
+            continue;
+        }
+
+        auto seen = std::find(missKeys.begin(), missKeys.end(), key);
+        missOf[i] = seen - missKeys.begin();
+        if (seen == missKeys.end()) {
+            missKeys.push_back(key);
+            missGoals.push_back(goals[i]);
+        }
+    }
+
+    std::vector<std::shared_ptr<FlowFieldLayer>> generated(missKeys.size());
+    pool.parallelFor(missKeys.size(), 1, [&](size_t begin, size_t end, unsigned) {
+        for (size_t i = begin; i < end; ++i) {
+            generated[i] = std::make_shared<FlowFieldLayer>();
+            field.generateInto(*generated[i], missGoals[i]);
+        }
+    });
+
+    misses += missKeys.size();
+    for (size_t i = 0; i < missKeys.size(); ++i) {
+        insert(missKeys[i], generated[i]);
+    }
+    for (size_t i = 0; i < goals.size(); ++i) {
+        if (missOf[i] != SIZE_MAX)
+            result[i] = generated[missOf[i]];
+    }
+    return result;
+}
+
+void FlowFieldCache::clear() {
+    entries.clear();
+    index.clear();
+}
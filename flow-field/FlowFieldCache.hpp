@@ -0,0 +1,70 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "FlowField.hpp"
+#include "../common/ThreadPool.hpp"
+
+// Bounded LRU cache of generated flow fields, keyed by goal cell, mode and the
+// FlowField's obstacle version. Layers are handed out as shared pointers, so
+// a squad keeps following its field even after the cache evicts it.
+class FlowFieldCache {
+public:
+    FlowFieldCache(const FlowField& field, size_t capacity);
+
+    // Field towards the goal; generated on the calling thread on a miss
+    std::shared_ptr<const FlowFieldLayer> get(sf::Vector2f goal);
+
+    // Fields for several goals (one per squad). Misses are generated in
+    // parallel on the pool; the result is in the same order as `goals`.
+    std::vector<std::shared_ptr<const FlowFieldLayer>> getBatch(const std::vector<sf::Vector2f>& goals, ThreadPool& pool);
+
+    void clear();
+
+    size_t size() const { return entries.size(); }
+    size_t getCapacity() const { return capacity; }
+    size_t getHits() const { return hits; }
+    size_t getMisses() const { return misses; }
+
+private:
+    struct Key {
+        int goalCell;
+        FlowFieldMode mode;
+        uint64_t obstacleVersion;
+
+        bool operator==(const Key& other) const {
+            return goalCell == other.goalCell && mode == other.mode && obstacleVersion == other.obstacleVersion;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            uint64_t h = (uint64_t)(uint32_t)key.goalCell * 0x9E3779B97F4A7C15ull;
+            h ^= (key.obstacleVersion + (uint64_t)key.mode) * 0xBF58476D1CE4E5B9ull;
+            return (size_t)(h ^ (h >> 29));
+        }
+    };
+
+    struct Entry {
+        Key key;
+        std::shared_ptr<const FlowFieldLayer> layer;
+    };
+
+    Key keyFor(sf::Vector2f goal) const;
+    std::shared_ptr<const FlowFieldLayer> find(const Key& key);
+    void insert(const Key& key, std::shared_ptr<const FlowFieldLayer> layer);
+
+    const FlowField& field;
+    size_t capacity;
+
+    std::list<Entry> entries; // Most recently used first
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+    uint64_t cachedVersion = 0;
+    size_t hits = 0;
+    size_t misses = 0;
+};
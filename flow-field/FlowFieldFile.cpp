@@ -0,0 +1,93 @@
+#include "FlowFieldFile.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+bool saveFlowFieldFile(const std::string& path, const FlowField& field, const FlowFieldLayer& layer) {
+    size_t cellCount = (size_t)field.getGridWidth() * field.getGridHeight();
+    if (layer.directions.size() != cellCount) {
+        std::cerr << "Can't save flow field to " << path << ": layer was never generated\n";
+        return false;
+    }
+
+    FlowFieldFileHeader header = {};
+    std::memcpy(header.magic, FLOW_FILE_MAGIC, sizeof(header.magic));
+    header.version = FLOW_FILE_VERSION;
+    header.gridWidth = field.getGridWidth();
+    header.gridHeight = field.getGridHeight();
+    header.cellSize = field.getCellSize();
+    header.goalCell = layer.goalCell;
+    header.mode = (uint32_t)layer.mode;
+    header.costHash = field.getCostHash();
+
+    // Two cells per byte, even cell in the low nibble
+    const uint8_t* costs = field.getCostData();
+    std::vector<uint8_t> packed((cellCount + 1) / 2, 0);
+    for (size_t cell = 0; cell < cellCount; ++cell) {
+        bool blocked = costs[cell] == OBSTACLE_COST && (int)cell != layer.goalCell;
+        uint8_t code = blocked ? FLOW_FILE_BLOCKED : layer.directions[cell];
+        packed[cell >> 1] |= code << ((cell & 1) * 4);
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write((const char*)&header, sizeof(header));
+    file.write((const char*)packed.data(), packed.size());
+    if (!file) {
+        std::cerr << "Failed to write flow field to " << path << "\n";
+        return false;
+    }
+    return true;
+}
+
+MappedFlowField::~MappedFlowField() {
+    close();
+}
+
+bool MappedFlowField::open(const std::string& path) {
+    close();
+
+    if (!file.open(path)) {
+        std::cerr << "Failed to open flow field " << path << "\n";
+        return false;
+    }
+
+    const uint8_t* data = file.getData();
+    size_t fileSize = file.getSize();
+    const FlowFieldFileHeader* candidate = (const FlowFieldFileHeader*)data;
+    bool valid = fileSize >= sizeof(FlowFieldFileHeader) &&
+                 std::memcmp(candidate->magic, FLOW_FILE_MAGIC, sizeof(candidate->magic)) == 0 &&
+                 candidate->version == FLOW_FILE_VERSION && candidate->gridWidth > 0 && candidate->gridHeight > 0 &&
+                 candidate->cellSize > 0 &&
+                 fileSize == sizeof(FlowFieldFileHeader) + ((size_t)candidate->gridWidth * candidate->gridHeight + 1) / 2;
+    if (!valid) {
+        std::cerr << "Not a flow field file (or wrong version): " << path << "\n";
+        close();
+        return false;
+    }
+
+    header = candidate;
+    cells = data + sizeof(FlowFieldFileHeader);
+    gridWidth = header->gridWidth;
+    gridHeight = header->gridHeight;
+    return true;
+}
+
+void MappedFlowField::close() {
+    file.close();
+    header = nullptr;
+    cells = nullptr;
+    gridWidth = gridHeight = 0;
+}
+
+bool MappedFlowField::matches(const FlowField& field) const {
+    return header && gridWidth == field.getGridWidth() && gridHeight == field.getGridHeight() &&
+           header->cellSize == field.getCellSize() && header->costHash == field.getCostHash();
+}
+
+sf::Vector2f MappedFlowField::getFlowDirection(sf::Vector2f position) const {
+    int cellSize = getCellSize();
+    if (cellSize <= 0)
+        return sf::Vector2f(0, 0);
+    return decodeDirection(getDirectionCode((int)(position.x / cellSize), (int)(position.y / cellSize)));
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "FlowField.hpp"
+#include "../common/MappedFile.hpp"
+
+// Precomputed flow field on disk: a fixed header followed by 4 bits per cell,
+// two cells per byte (even cell in the low nibble). Nibbles hold the packed
+// direction code, DIRECTION_NONE or FLOW_FILE_BLOCKED. Fields are written in
+// the machine's byte order. The magic is plain bytes and matches anywhere; a
+// file from a different-endian machine is rejected because its version reads
+// byte-swapped.
+const char FLOW_FILE_MAGIC[4] = {'F', 'F', 'L', 'D'};
+const uint32_t FLOW_FILE_VERSION = 1;
+const uint8_t FLOW_FILE_BLOCKED = 15;
+
+struct FlowFieldFileHeader {
+    char magic[4];
+    uint32_t version;
+    int32_t gridWidth;
+    int32_t gridHeight;
+    int32_t cellSize;
+    int32_t goalCell;
+    uint32_t mode;     // FlowFieldMode the field was generated with
+    uint32_t reserved;
+    uint64_t costHash; // FlowField::getCostHash() of the map it was baked from
+};
+static_assert(sizeof(FlowFieldFileHeader) == 40, "flow field file header must stay 40 bytes");
+
+// Write a generated layer as a packed file. Returns false (and reports why on
+// std::cerr) if the layer is empty or the file can't be written.
+bool saveFlowFieldFile(const std::string& path, const FlowField& field, const FlowFieldLayer& layer);
+
+// Read-only view of a packed field file, mapped straight into memory. Lookups
+// read the nibbles in place, so opening costs a header check regardless of
+// map size and pages are only faulted in where agents actually are.
+class MappedFlowField {
+public:
+    MappedFlowField() = default;
+    ~MappedFlowField();
+    MappedFlowField(const MappedFlowField&) = delete;
+    MappedFlowField& operator=(const MappedFlowField&) = delete;
+
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return header != nullptr; }
+
+    // Same grid and costs as the map the field was baked from
+    bool matches(const FlowField& field) const;
+
+    // Direction code at a cell; DIRECTION_NONE outside the grid or on blocked cells
+    uint8_t getDirectionCode(int cellX, int cellY) const {
+        uint8_t code = getNibble(cellX, cellY);
+        return code == FLOW_FILE_BLOCKED ? DIRECTION_NONE : code;
+    }
+    bool isBlocked(int cellX, int cellY) const { return getNibble(cellX, cellY) == FLOW_FILE_BLOCKED; }
+
+    // Same convention as FlowField: agents move along -getFlowDirection()
+    sf::Vector2f getFlowDirection(sf::Vector2f position) const;
+
+    int getGridWidth() const { return gridWidth; }
+    int getGridHeight() const { return gridHeight; }
+    int getCellSize() const { return header ? header->cellSize : 0; }
+    int getGoalCell() const { return header ? header->goalCell : -1; }
+    FlowFieldMode getMode() const { return header ? (FlowFieldMode)header->mode : FlowFieldMode::Bfs; }
+    uint64_t getCostHash() const { return header ? header->costHash : 0; }
+
+    // Bytes of the whole file, header included
+    size_t getFileSize() const { return file.getSize(); }
+
+private:
+    uint8_t getNibble(int cellX, int cellY) const {
+        if (cellX < 0 || cellX >= gridWidth || cellY < 0 || cellY >= gridHeight)
+            return DIRECTION_NONE;
+        size_t cell = (size_t)cellY * gridWidth + cellX;
+        return (cells[cell >> 1] >> ((cell & 1) * 4)) & 0xF;
+    }
+
+    const FlowFieldFileHeader* header = nullptr;
+    const uint8_t* cells = nullptr;
+    int gridWidth = 0, gridHeight = 0;
+    MappedFile file;
+};
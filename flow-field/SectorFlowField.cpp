@@ -0,0 +1,474 @@
+#include "SectorFlowField.hpp"
+
+#include <algorithm>
+
+namespace {
+
+// Binary heap with the BucketQueue interface, for floods whose seeds are
+// further apart than a bucket ring can hold
+class HeapQueue {
+public:
+    void push(uint32_t dist, uint32_t cell) { heap.push(std::make_pair(dist, cell)); }
+    bool empty() const { return heap.empty(); }
+    uint32_t pop(uint32_t& dist) {
+        dist = heap.top().first;
+        uint32_t cell = heap.top().second;
+        heap.pop();
+        return cell;
+    }
+
+private:
+    std::priority_queue<std::pair<uint32_t, uint32_t>, std::vector<std::pair<uint32_t, uint32_t>>,
+                        std::greater<std::pair<uint32_t, uint32_t>>> heap;
+};
+
+} // namespace
+
+SectorFlowField::SectorFlowField(const FlowField& field, int sectorSize)
+    : field(field), sectorSize(sectorSize) {
+    gridWidth = field.getGridWidth();
+    gridHeight = field.getGridHeight();
+    sectorsX = (gridWidth + sectorSize - 1) / sectorSize;
+    sectorsY = (gridHeight + sectorSize - 1) / sectorSize;
+    scratch.dist.resize((size_t)sectorSize * sectorSize);
+    rebuild();
+}
+
+void SectorFlowField::rebuild() {
+    size_t sectorCount = (size_t)sectorsX * sectorsY;
+
+    nodeCell.clear();
+    nodePartner.clear();
+    nodeSector.clear();
+    sectorNodes.assign(sectorCount, std::vector<uint32_t>());
+    scanBorders();
+    labelComponents();
+
+    nodeEdges.assign(nodeCell.size(), std::vector<Edge>());
+    sectorEdgesBuilt.assign(sectorCount, 0);
+    nodeDist.assign(nodeCell.size(), UNREACHABLE);
+    nodeStamp.assign(nodeCell.size(), 0);
+    nodeSettledStamp.assign(nodeCell.size(), 0);
+    sectorFields.assign(sectorCount, SectorCache());
+
+    // Replan towards the same goal over the new portals
+    if (goalCell >= 0) {
+        setGoal(sf::Vector2f((goalCell % gridWidth + 0.5f) * field.getCellSize(), (goalCell / gridWidth + 0.5f) * field.getCellSize()));
+    }
+}
+
+void SectorFlowField::addPortal(uint32_t cellA, uint32_t cellB) {
+    uint32_t a = (uint32_t)nodeCell.size();
+    int sectorA = sectorOf(cellA % gridWidth, cellA / gridWidth);
+    int sectorB = sectorOf(cellB % gridWidth, cellB / gridWidth);
+
+    nodeCell.push_back(cellA);
+    nodePartner.push_back(a + 1);
+    nodeSector.push_back(sectorA);
+    sectorNodes[sectorA].push_back(a);
+
+    nodeCell.push_back(cellB);
+    nodePartner.push_back(a);
+    nodeSector.push_back(sectorB);
+    sectorNodes[sectorB].push_back(a + 1);
+}
+
+void SectorFlowField::scanBorders() {
+    const uint8_t* costs = field.getCostData();
+    auto open = [&](int x, int y) { return costs[y * gridWidth + x] != OBSTACLE_COST; };
+
+    for (int sy = 0; sy < sectorsY; ++sy) {
+        for (int sx = 0; sx < sectorsX; ++sx) {
+            int x0 = sx * sectorSize, y0 = sy * sectorSize;
+            int x1 = std::min(x0 + sectorSize, gridWidth);
+            int y1 = std::min(y0 + sectorSize, gridHeight);
+
+            // Right border: one portal in the middle of each run of open pairs
+            if (x1 < gridWidth) {
+                int runStart = -1;
+                for (int y = y0; y <= y1; ++y) {
+                    bool passable = y < y1 && open(x1 - 1, y) && open(x1, y);
+                    if (passable && runStart < 0) {
+                        runStart = y;
+                    } else if (!passable && runStart >= 0) {
+                        int mid = (runStart + y - 1) / 2;
+                        addPortal(mid * gridWidth + x1 - 1, mid * gridWidth + x1);
+                        runStart = -1;
+                    }
+                }
+            }
+
+            // Bottom border
+            if (y1 < gridHeight) {
+                int runStart = -1;
+                for (int x = x0; x <= x1; ++x) {
+                    bool passable = x < x1 && open(x, y1 - 1) && open(x, y1);
+                    if (passable && runStart < 0) {
+                        runStart = x;
+                    } else if (!passable && runStart >= 0) {
+                        int mid = (runStart + x - 1) / 2;
+                        addPortal((y1 - 1) * gridWidth + mid, y1 * gridWidth + mid);
+                        runStart = -1;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void SectorFlowField::labelComponents() {
+    // Union-find over portal nodes: partners are joined, and so are nodes
+    // that share a 4-connected region inside their sector (diagonal steps
+    // never connect anything 4-way steps don't, given the corner rule)
+    std::vector<uint32_t> parent(nodeCell.size());
+    for (uint32_t i = 0; i < parent.size(); ++i) {
+        parent[i] = i;
+    }
+    auto find = [&](uint32_t node) {
+        while (parent[node] != node) {
+            parent[node] = parent[parent[node]];
+            node = parent[node];
+        }
+        return node;
+    };
+    auto join = [&](uint32_t a, uint32_t b) { parent[find(a)] = find(b); };
+
+    const uint8_t* costs = field.getCostData();
+    std::vector<uint32_t> label((size_t)sectorSize * sectorSize);
+    std::vector<uint32_t> stack;
+    for (size_t sector = 0; sector < sectorNodes.size(); ++sector) {
+        const std::vector<uint32_t>& nodes = sectorNodes[sector];
+        if (nodes.size() < 2)
+            continue;
+
+        int x0 = (sector % sectorsX) * sectorSize;
+        int y0 = (sector / sectorsX) * sectorSize;
+        int w = std::min(sectorSize, gridWidth - x0);
+        int h = std::min(sectorSize, gridHeight - y0);
+        std::fill(label.begin(), label.end(), UNREACHABLE);
+
+        // Flood from each unlabelled portal; the portal that started a region
+        // is its label
+        for (uint32_t node : nodes) {
+            uint32_t start = (nodeCell[node] / gridWidth - y0) * sectorSize + nodeCell[node] % gridWidth - x0;
+            if (label[start] != UNREACHABLE) {
+                join(node, label[start]);
+                continue;
+            }
+
+            label[start] = node;
+            stack.assign(1, start);
+            while (!stack.empty()) {
+                uint32_t local = stack.back();
+                stack.pop_back();
+                int lx = local % sectorSize, ly = local / sectorSize;
+                for (uint8_t d = 0; d < 4; ++d) {
+                    int nx = lx + DIRECTION_OFFSETS[d].x;
+                    int ny = ly + DIRECTION_OFFSETS[d].y;
+                    if (nx < 0 || nx >= w || ny < 0 || ny >= h)
+                        continue;
+                    uint32_t neighbor = ny * sectorSize + nx;
+                    if (label[neighbor] != UNREACHABLE || costs[(y0 + ny) * gridWidth + x0 + nx] == OBSTACLE_COST)
+                        continue;
+                    label[neighbor] = node;
+                    stack.push_back(neighbor);
+                }
+            }
+        }
+    }
+    for (uint32_t node = 0; node < nodeCell.size(); ++node) {
+        join(node, nodePartner[node]);
+    }
+
+    nodeComponent.resize(nodeCell.size());
+    for (uint32_t node = 0; node < nodeCell.size(); ++node) {
+        nodeComponent[node] = find(node);
+    }
+}
+
+void SectorFlowField::floodSector(int sector, const std::vector<QueueEntry>& seeds, FloodScratch& scratch) const {
+    int x0 = (sector % sectorsX) * sectorSize;
+    int y0 = (sector / sectorsX) * sectorSize;
+
+    scratch.dist.assign((size_t)sectorSize * sectorSize, UNREACHABLE);
+    auto seed = [&](auto& queue) {
+        for (const QueueEntry& entry : seeds) {
+            uint32_t local = (entry.second / gridWidth - y0) * sectorSize + entry.second % gridWidth - x0;
+            if (entry.first < scratch.dist[local]) {
+                scratch.dist[local] = entry.first;
+                queue.push(entry.first, local);
+            }
+        }
+    };
+
+    // Buckets work as long as every seed fits in the ring from the smallest
+    uint32_t lowest = UNREACHABLE, highest = 0;
+    for (const QueueEntry& entry : seeds) {
+        lowest = std::min(lowest, entry.first);
+        highest = std::max(highest, entry.first);
+    }
+
+    if (seeds.empty()) {
+        return;
+    } else if (highest - lowest <= scratch.buckets.getMaxStep()) {
+        scratch.buckets.reset(lowest);
+        seed(scratch.buckets);
+        flood(sector, scratch.buckets, scratch.dist);
+    } else {
+        HeapQueue queue;
+        seed(queue);
+        flood(sector, queue, scratch.dist);
+    }
+}
+
+template <typename Queue>
+void SectorFlowField::flood(int sector, Queue& queue, std::vector<uint32_t>& dist) const {
+    const uint8_t* costs = field.getCostData();
+    int x0 = (sector % sectorsX) * sectorSize;
+    int y0 = (sector / sectorsX) * sectorSize;
+    int w = std::min(sectorSize, gridWidth - x0);
+    int h = std::min(sectorSize, gridHeight - y0);
+
+    while (!queue.empty()) {
+        uint32_t current;
+        uint32_t local = queue.pop(current);
+        if (current != dist[local])
+            continue; // Stale entry
+
+        int lx = local % sectorSize, ly = local / sectorSize;
+        for (uint8_t d = 0; d < DIRECTION_COUNT; ++d) {
+            int nx = lx + DIRECTION_OFFSETS[d].x;
+            int ny = ly + DIRECTION_OFFSETS[d].y;
+            if (nx < 0 || nx >= w || ny < 0 || ny >= h)
+                continue;
+
+            uint8_t cost = costs[(y0 + ny) * gridWidth + x0 + nx];
+            if (cost == OBSTACLE_COST)
+                continue;
+
+            uint32_t step = STRAIGHT_STEP;
+            if (d >= 4) {
+                // No cutting corners past obstacles
+                if (costs[(y0 + ly) * gridWidth + x0 + nx] == OBSTACLE_COST ||
+                    costs[(y0 + ny) * gridWidth + x0 + lx] == OBSTACLE_COST)
+                    continue;
+                step = DIAGONAL_STEP;
+            }
+
+            uint32_t neighbor = ny * sectorSize + nx;
+            uint32_t candidate = current + cost * step;
+            if (candidate < dist[neighbor]) {
+                dist[neighbor] = candidate;
+                queue.push(candidate, neighbor);
+            }
+        }
+    }
+}
+
+void SectorFlowField::precomputeEdges(ThreadPool& pool) {
+    std::vector<FloodScratch> scratches(pool.getThreadCount());
+    pool.parallelFor(sectorNodes.size(), 64, [&](size_t begin, size_t end, unsigned thread) {
+        for (size_t sector = begin; sector < end; ++sector) {
+            buildEdges((int)sector, scratches[thread]);
+        }
+    });
+}
+
+void SectorFlowField::buildEdges(int sector, FloodScratch& scratch) {
+    if (sectorEdgesBuilt[sector])
+        return;
+    sectorEdgesBuilt[sector] = 1;
+
+    int x0 = (sector % sectorsX) * sectorSize;
+    int y0 = (sector / sectorsX) * sectorSize;
+    const std::vector<uint32_t>& nodes = sectorNodes[sector];
+
+    // Edges are directed: a flood from `from` charges the cost of every cell
+    // after it, which is the cost of walking towards `from`
+    for (uint32_t from : nodes) {
+        floodSector(sector, std::vector<QueueEntry>(1, QueueEntry(0, nodeCell[from])), scratch);
+        for (uint32_t to : nodes) {
+            if (to == from)
+                continue;
+            uint32_t cell = nodeCell[to];
+            uint32_t dist = scratch.dist[(cell / gridWidth - y0) * sectorSize + cell % gridWidth - x0];
+            if (dist != UNREACHABLE)
+                nodeEdges[from].push_back({to, dist});
+        }
+    }
+}
+
+void SectorFlowField::setGoal(sf::Vector2f goal) {
+    ++goalStamp;
+    builtSectors = 0;
+    settledNodes = 0;
+    open = decltype(open)();
+
+    int goalX = std::max(0, std::min((int)(goal.x / field.getCellSize()), gridWidth - 1));
+    int goalY = std::max(0, std::min((int)(goal.y / field.getCellSize()), gridHeight - 1));
+    goalCell = goalY * gridWidth + goalX;
+    goalComponent = UNREACHABLE;
+    if (field.getCost(goalX, goalY) == OBSTACLE_COST)
+        return;
+
+    // Seed the portal search with the goal sector's own portals
+    int sector = sectorOf(goalX, goalY);
+    int x0 = (sector % sectorsX) * sectorSize;
+    int y0 = (sector / sectorsX) * sectorSize;
+    floodSector(sector, std::vector<QueueEntry>(1, QueueEntry(0, goalCell)), scratch);
+    for (uint32_t node : sectorNodes[sector]) {
+        uint32_t cell = nodeCell[node];
+        uint32_t dist = scratch.dist[(cell / gridWidth - y0) * sectorSize + cell % gridWidth - x0];
+        if (dist != UNREACHABLE) {
+            nodeDist[node] = dist;
+            nodeStamp[node] = goalStamp;
+            goalComponent = nodeComponent[node];
+            open.push(QueueEntry(dist, node));
+        }
+    }
+}
+
+void SectorFlowField::settleSector(int sector) {
+    // Portals the goal can't reach would never settle; don't wait for them
+    size_t unsettled = 0;
+    for (uint32_t node : sectorNodes[sector]) {
+        if (nodeSettledStamp[node] != goalStamp && nodeComponent[node] == goalComponent)
+            ++unsettled;
+    }
+
+    const uint8_t* costs = field.getCostData();
+    auto relax = [&](uint32_t node, uint32_t dist) {
+        if (dist < nodeDistance(node)) {
+            nodeDist[node] = dist;
+            nodeStamp[node] = goalStamp;
+            open.push(QueueEntry(dist, node));
+        }
+    };
+
+    // Resume the search until every portal of this sector has its final
+    // distance (or the reachable graph is exhausted)
+    while (unsettled > 0 && !open.empty()) {
+        QueueEntry top = open.top();
+        open.pop();
+        uint32_t node = top.second;
+        if (top.first != nodeDistance(node) || nodeSettledStamp[node] == goalStamp)
+            continue; // Stale entry
+
+        nodeSettledStamp[node] = goalStamp;
+        ++settledNodes;
+        if ((int)nodeSector[node] == sector && nodeComponent[node] == goalComponent)
+            --unsettled;
+
+        buildEdges(nodeSector[node], scratch);
+        for (const Edge& edge : nodeEdges[node]) {
+            relax(edge.to, top.first + edge.cost);
+        }
+        uint32_t partner = nodePartner[node];
+        relax(partner, top.first + costs[nodeCell[partner]] * STRAIGHT_STEP);
+    }
+}
+
+void SectorFlowField::buildSectorField(int sector) {
+    SectorCache& cache = sectorFields[sector];
+    if (cache.goalStamp == goalStamp && !cache.directions.empty())
+        return;
+
+    settleSector(sector);
+
+    const uint8_t* costs = field.getCostData();
+    int x0 = (sector % sectorsX) * sectorSize;
+    int y0 = (sector / sectorsX) * sectorSize;
+    int w = std::min(sectorSize, gridWidth - x0);
+    int h = std::min(sectorSize, gridHeight - y0);
+    auto localIndex = [&](uint32_t cell) { return (cell / gridWidth - y0) * sectorSize + cell % gridWidth - x0; };
+
+    std::vector<QueueEntry> seeds;
+    for (uint32_t node : sectorNodes[sector]) {
+        if (nodeDistance(node) != UNREACHABLE)
+            seeds.push_back(QueueEntry(nodeDistance(node), nodeCell[node]));
+    }
+    if (goalCell >= 0 && sectorOf(goalCell % gridWidth, goalCell / gridWidth) == sector && costs[goalCell] != OBSTACLE_COST)
+        seeds.push_back(QueueEntry(0, goalCell));
+    floodSector(sector, seeds, scratch);
+    const std::vector<uint32_t>& localDist = scratch.dist;
+
+    // Same downhill rule as FlowField::buildDirections, inside the sector
+    std::vector<uint32_t> best(localDist);
+    cache.directions.assign((size_t)sectorSize * sectorSize, DIRECTION_NONE);
+    for (int ly = 0; ly < h; ++ly) {
+        for (int lx = 0; lx < w; ++lx) {
+            int local = ly * sectorSize + lx;
+            if (localDist[local] == UNREACHABLE || localDist[local] == 0)
+                continue;
+
+            uint8_t bestDir = DIRECTION_NONE;
+            for (uint8_t d = 0; d < DIRECTION_COUNT; ++d) {
+                int nx = lx + DIRECTION_OFFSETS[d].x;
+                int ny = ly + DIRECTION_OFFSETS[d].y;
+                if (nx < 0 || nx >= w || ny < 0 || ny >= h)
+                    continue;
+                if (d >= 4 && (costs[(y0 + ly) * gridWidth + x0 + nx] == OBSTACLE_COST ||
+                               costs[(y0 + ny) * gridWidth + x0 + lx] == OBSTACLE_COST))
+                    continue;
+
+                uint32_t value = localDist[ny * sectorSize + nx];
+                if (value < best[local]) {
+                    best[local] = value;
+                    bestDir = d;
+                }
+            }
+            if (bestDir != DIRECTION_NONE)
+                cache.directions[local] = oppositeDirection(bestDir);
+        }
+    }
+
+    // Portal cells may do better by stepping across the border
+    for (uint32_t node : sectorNodes[sector]) {
+        uint32_t partner = nodePartner[node];
+        uint32_t local = localIndex(nodeCell[node]);
+        if (nodeDistance(partner) >= best[local])
+            continue;
+
+        int dx = (int)(nodeCell[partner] % gridWidth) - (int)(nodeCell[node] % gridWidth);
+        int dy = (int)(nodeCell[partner] / gridWidth) - (int)(nodeCell[node] / gridWidth);
+        for (uint8_t d = 0; d < 4; ++d) {
+            if (DIRECTION_OFFSETS[d].x == dx && DIRECTION_OFFSETS[d].y == dy) {
+                best[local] = nodeDistance(partner);
+                cache.directions[local] = oppositeDirection(d);
+            }
+        }
+    }
+
+    cache.goalStamp = goalStamp;
+    ++builtSectors;
+}
+
+void SectorFlowField::requireSector(int cellX, int cellY) {
+    if (cellX < 0 || cellX >= gridWidth || cellY < 0 || cellY >= gridHeight || goalCell < 0)
+        return;
+    buildSectorField(sectorOf(cellX, cellY));
+}
+
+void SectorFlowField::requireSectors(const float* xs, const float* ys, size_t count) {
+    float invCellSize = 1.0f / field.getCellSize();
+    for (size_t i = 0; i < count; ++i) {
+        requireSector((int)(xs[i] * invCellSize), (int)(ys[i] * invCellSize));
+    }
+}
+
+sf::Vector2f SectorFlowField::getFlowDirection(sf::Vector2f position) {
+    int cellX = position.x / field.getCellSize();
+    int cellY = position.y / field.getCellSize();
+    requireSector(cellX, cellY);
+    return decodeDirection(getDirectionCode(cellX, cellY));
+}
+
+uint8_t SectorFlowField::getDirectionCode(int cellX, int cellY) const {
+    if (cellX < 0 || cellX >= gridWidth || cellY < 0 || cellY >= gridHeight)
+        return DIRECTION_NONE;
+
+    const SectorCache& cache = sectorFields[sectorOf(cellX, cellY)];
+    if (cache.goalStamp != goalStamp || cache.directions.empty())
+        return DIRECTION_NONE;
+    return cache.directions[(cellY % sectorSize) * sectorSize + cellX % sectorSize];
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+#include "BucketQueue.hpp"
+#include "FlowField.hpp"
+#include "../common/ThreadPool.hpp"
+
+// Hierarchical flow field over the costs of a FlowField.
+//
+// The grid is split into square sectors. Every run of open cells along a
+// sector border becomes a portal: a pair of nodes, one on each side. A goal
+// change only floods the goal's sector and seeds a Dijkstra over the portal
+// graph; that search is resumed just far enough to settle the portals of a
+// sector when something first asks for a direction inside it, and only then
+// is that sector's local field built and cached. Work therefore follows the
+// sectors agents occupy, not the size of the map. Paths are optimal within a
+// sector and between portals, but portals sit at the middle of each open run,
+// so long routes can be slightly longer than a full weighted field's.
+class SectorFlowField {
+public:
+    SectorFlowField(const FlowField& field, int sectorSize = 32);
+
+    // Re-scan portals after traversal costs changed; drops all cached fields
+    void rebuild();
+
+    // Build every sector's portal-to-portal costs up front, in parallel. These
+    // don't depend on the goal, so on a static map a goal change then only
+    // walks the portal graph and floods the sectors agents stand in.
+    void precomputeEdges(ThreadPool& pool);
+
+    void setGoal(sf::Vector2f goal);
+
+    // Build (if needed) the field of the sector containing this cell
+    void requireSector(int cellX, int cellY);
+
+    // Build the fields of every sector containing one of these positions
+    void requireSectors(const float* xs, const float* ys, size_t count);
+
+    // Flow direction at a position; builds the sector's field on first use
+    sf::Vector2f getFlowDirection(sf::Vector2f position);
+
+    // Direction code at a cell, DIRECTION_NONE if its sector isn't built yet
+    uint8_t getDirectionCode(int cellX, int cellY) const;
+
+    int getCellSize() const { return field.getCellSize(); }
+    int getSectorSize() const { return sectorSize; }
+    size_t getSectorCount() const { return sectorFields.size(); }
+    size_t getPortalNodeCount() const { return nodeCell.size(); }
+
+    // Sector fields built and portal nodes settled since the last setGoal
+    size_t getBuiltSectorCount() const { return builtSectors; }
+    size_t getSettledNodeCount() const { return settledNodes; }
+
+private:
+    struct Edge {
+        uint32_t to;
+        uint32_t cost;
+    };
+
+    struct SectorCache {
+        uint32_t goalStamp = 0;
+        std::vector<uint8_t> directions; // sectorSize * sectorSize, local row-major
+    };
+
+    typedef std::pair<uint32_t, uint32_t> QueueEntry; // (distance, node or cell)
+
+    // Per-thread buffers for sector floods
+    struct FloodScratch {
+        std::vector<uint32_t> dist; // sectorSize * sectorSize, local row-major
+        BucketQueue buckets;
+    };
+
+    int sectorOf(int cellX, int cellY) const { return (cellY / sectorSize) * sectorsX + cellX / sectorSize; }
+    void addPortal(uint32_t cellA, uint32_t cellB);
+    void scanBorders();
+    void labelComponents();
+    void floodSector(int sector, const std::vector<QueueEntry>& seeds, FloodScratch& scratch) const;
+    template <typename Queue>
+    void flood(int sector, Queue& queue, std::vector<uint32_t>& dist) const;
+    void buildEdges(int sector, FloodScratch& scratch);
+    void settleSector(int sector);
+    void buildSectorField(int sector);
+
+    uint32_t nodeDistance(uint32_t node) const { return nodeStamp[node] == goalStamp ? nodeDist[node] : UNREACHABLE; }
+
+    const FlowField& field;
+    int sectorSize;
+    int gridWidth, gridHeight;
+    int sectorsX, sectorsY;
+
+    // Portal nodes
+    std::vector<uint32_t> nodeCell;    // Global cell index
+    std::vector<uint32_t> nodePartner; // Node on the other side of the border
+    std::vector<uint32_t> nodeSector;
+    std::vector<std::vector<uint32_t>> sectorNodes;
+    std::vector<uint32_t> nodeComponent; // Portals with different ids can't reach each other
+
+    // Intra-sector node-to-node costs, built when a sector is first expanded
+    std::vector<std::vector<Edge>> nodeEdges;
+    std::vector<uint8_t> sectorEdgesBuilt;
+
+    // Resumable portal-graph Dijkstra from the current goal
+    uint32_t goalStamp = 0;
+    int goalCell = -1;
+    uint32_t goalComponent = UNREACHABLE;
+    std::vector<uint32_t> nodeDist;
+    std::vector<uint32_t> nodeStamp;
+    std::vector<uint32_t> nodeSettledStamp;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> open;
+
+    std::vector<SectorCache> sectorFields;
+    FloodScratch scratch;
+    size_t builtSectors = 0;
+    size_t settledNodes = 0;
+};
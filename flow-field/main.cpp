@@ -1,9 +1,22 @@
 #include <SFML/Graphics.hpp>
-#include <vector>
-#include <queue>
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstdlib>
 #include <ctime>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <string>
+#include <thread>
+#include "AgentSystem.hpp"
+#include "../common/BatchLayer.hpp"
+#include "../common/Camera.hpp"
+#include "../common/GameLoop.hpp"
+#include "FlowField.hpp"
+#include "FlowFieldCache.hpp"
+#include "FlowFieldFile.hpp"
+#include "SectorFlowField.hpp"
 
 // Constants
 const int WINDOW_WIDTH = 800;
@@ -11,151 +24,424 @@ const int WINDOW_HEIGHT = 600;
 const int SQUARE_SIZE = 10;
 const int NUM_BLUE_SQUARES = 500;
 const int GRID_SIZE = 20; // Size of each cell in the flow field grid
+const uint8_t MUD_COST = 6; // Traversal cost of mud cells in weighted mode
+const float AGENT_SPEED = 0.1f;
+const int SECTOR_SIZE = 8; // Cells per sector side in hierarchical mode
+const size_t FIELD_CACHE_SIZE = 16; // Goals kept by the flow field cache
+const float SEPARATION_RADIUS = SQUARE_SIZE; // Agents closer than this push apart
+const float SEPARATION_STRENGTH = 0.2f; // Max separation push per step, in pixels
+
+// Headless scaling run: agents per second for 1..maxThreads worker threads
+int runAgentBenchmark(size_t agentCount, unsigned maxThreads, int frames) {
+    const int worldSize = 4000;
+    FlowField flowField(worldSize, worldSize, GRID_SIZE);
+    srand(1);
+    for (int i = 0; i < 2000; ++i) {
+        flowField.setObstacle(rand() % (worldSize / GRID_SIZE), rand() % (worldSize / GRID_SIZE));
+    }
+    sf::Vector2f goal(worldSize / 2, worldSize / 2);
+    flowField.generateFlowField(goal);
+
+    std::cout << "agents=" << agentCount << " frames=" << frames << "\n";
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        ThreadPool pool(threads);
+        AgentSystem agents(agentCount, worldSize, worldSize, SQUARE_SIZE, 1);
+
+        double total = 0.0;
+        for (int frame = 0; frame < frames; ++frame) {
+            agents.update(flowField, goal, AGENT_SPEED, pool);
+            total += agentCount / agents.getAgentsPerSecond();
+        }
+        std::cout << "threads=" << threads << " agents/s=" << (agentCount * frames / total) << "\n";
+    }
+    return 0;
+}
 
-// Directions for grid movement (up, down, left, right)
-const sf::Vector2i directions[] = {
-    sf::Vector2i(0, -1),  // Up
-    sf::Vector2i(1, 0),   // Right
-    sf::Vector2i(0, 1),   // Down
-    sf::Vector2i(-1, 0)   // Left
-};
-
-// Structure to store each grid cell's flow vector
-struct FlowFieldCell {
-    sf::Vector2f direction;
-    bool visited = false;
-    bool isObstacle = false; // Flag to mark obstacle cells
-};
-
-// Flow Field Class
-class FlowField {
-public:
-    FlowField(int width, int height, int cellSize)
-        : width(width), height(height), cellSize(cellSize) {
-        // Calculate number of cells in each dimension
-        gridWidth = width / cellSize;
-        gridHeight = height / cellSize;
-        flowField.resize(gridWidth, std::vector<FlowFieldCell>(gridHeight));
-    }
-
-    // Generate the flow field based on a given goal position
-    void generateFlowField(sf::Vector2f goal) {
-        // Reset all cells
-        for (int x = 0; x < gridWidth; ++x) {
-            for (int y = 0; y < gridHeight; ++y) {
-                flowField[x][y].visited = false;
-                flowField[x][y].direction = sf::Vector2f(0, 0);
+// Headless crowd run: frame time of the full agent update (flow plus
+// separation) against flow-only, on a pool of every core
+int runCrowdBenchmark(size_t agentCount, int frames) {
+    const int worldSize = 4000;
+    FlowField flowField(worldSize, worldSize, GRID_SIZE);
+    srand(1);
+    for (int i = 0; i < 2000; ++i) {
+        flowField.setObstacle(rand() % (worldSize / GRID_SIZE), rand() % (worldSize / GRID_SIZE));
+    }
+    sf::Vector2f goal(worldSize / 2, worldSize / 2);
+    flowField.generateFlowField(goal);
+
+    ThreadPool pool;
+    std::cout << "agents=" << agentCount << " frames=" << frames << " threads=" << pool.getThreadCount() << "\n";
+    for (int separation = 0; separation < 2; ++separation) {
+        AgentSystem agents(agentCount, worldSize, worldSize, SQUARE_SIZE, 1);
+        agents.setSeparation(SEPARATION_RADIUS, separation ? SEPARATION_STRENGTH : 0.f);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; ++frame) {
+            agents.update(flowField, goal, AGENT_SPEED, pool);
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << (separation ? "flow+separation" : "flow only") << " frame=" << ms / frames << "ms\n";
+    }
+    return 0;
+}
+
+// Headless hierarchical run: goal changes on a large map, with agents
+// scattered around the goal so only part of the map is ever planned
+int runSectorBenchmark(int gridSize) {
+    FlowField flowField(gridSize, gridSize, 1);
+    srand(1);
+    for (int i = 0; i < gridSize * gridSize / 2500; ++i) {
+        // Rectangular buildings
+        int x = rand() % gridSize, y = rand() % gridSize;
+        int w = 5 + rand() % 40, h = 5 + rand() % 40;
+        for (int bx = x; bx < std::min(x + w, gridSize); ++bx) {
+            for (int by = y; by < std::min(y + h, gridSize); ++by) {
+                flowField.setObstacle(bx, by);
             }
         }
+    }
 
-        // BFS queue
-        std::queue<sf::Vector2i> queue;
-        sf::Vector2i goalCell(goal.x / cellSize, goal.y / cellSize);
+    auto elapsedMs = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    SectorFlowField sectorField(flowField, 32);
+    std::cout << "grid=" << gridSize << " portals=" << sectorField.getPortalNodeCount()
+              << " scan=" << elapsedMs(start) << "ms\n";
+
+    ThreadPool pool;
+    start = std::chrono::steady_clock::now();
+    sectorField.precomputeEdges(pool);
+    std::cout << "precomputeEdges=" << elapsedMs(start) << "ms threads=" << pool.getThreadCount() << "\n";
+
+    std::vector<float> xs(1000), ys(1000);
+    for (int goal = 0; goal < 5; ++goal) {
+        sf::Vector2f target(rand() % gridSize, rand() % gridSize);
+        for (size_t i = 0; i < xs.size(); ++i) {
+            xs[i] = std::max(0.f, std::min(target.x + rand() % 2000 - 1000, gridSize - 1.f));
+            ys[i] = std::max(0.f, std::min(target.y + rand() % 2000 - 1000, gridSize - 1.f));
+        }
 
-        // Start BFS from the goal position
-        queue.push(goalCell);
-        flowField[goalCell.x][goalCell.y].visited = true;
+        start = std::chrono::steady_clock::now();
+        sectorField.setGoal(target);
+        sectorField.requireSectors(xs.data(), ys.data(), xs.size());
+        std::cout << "goal change=" << elapsedMs(start) << "ms sectors=" << sectorField.getBuiltSectorCount()
+                  << "/" << sectorField.getSectorCount() << " portals settled=" << sectorField.getSettledNodeCount() << "\n";
+    }
+    return 0;
+}
 
-        // BFS propagation
-        while (!queue.empty()) {
-            sf::Vector2i current = queue.front();
-            queue.pop();
+// Headless multi-goal run: K squad goals generated one by one, then as a
+// parallel batch through the cache, then again (all cache hits)
+int runGoalBenchmark(int squads, int gridSize) {
+    FlowField flowField(gridSize, gridSize, 1);
+    flowField.setMode(FlowFieldMode::Weighted);
+    srand(1);
+    for (int i = 0; i < gridSize * gridSize / 10; ++i) {
+        flowField.setObstacle(rand() % gridSize, rand() % gridSize);
+    }
 
-            // For each direction (up, right, down, left)
-            for (const sf::Vector2i& dir : directions) {
-                sf::Vector2i neighbor = current + dir;
+    std::vector<sf::Vector2f> goals;
+    for (int i = 0; i < squads; ++i) {
+        goals.push_back(sf::Vector2f(rand() % gridSize, rand() % gridSize));
+    }
 
-                // Check if the neighbor is within bounds and not an obstacle
-                if (neighbor.x >= 0 && neighbor.x < gridWidth &&
-                    neighbor.y >= 0 && neighbor.y < gridHeight &&
-                    !flowField[neighbor.x][neighbor.y].visited &&
-                    !flowField[neighbor.x][neighbor.y].isObstacle) {
+    auto elapsedMs = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
 
-                    // Set the direction to move from the current cell to the neighbor
-                    flowField[neighbor.x][neighbor.y].direction = sf::Vector2f(dir.x, dir.y);
-                    flowField[neighbor.x][neighbor.y].visited = true;
+    auto start = std::chrono::steady_clock::now();
+    for (const sf::Vector2f& goal : goals) {
+        flowField.generateFlowField(goal);
+    }
+    std::cout << "squads=" << squads << " grid=" << gridSize << " serial=" << elapsedMs(start) << "ms\n";
 
-                    // Add the neighbor to the queue
-                    queue.push(neighbor);
-                }
-            }
-        }
+    ThreadPool pool;
+    FlowFieldCache cache(flowField, squads);
+    start = std::chrono::steady_clock::now();
+    cache.getBatch(goals, pool);
+    std::cout << "batch=" << elapsedMs(start) << "ms threads=" << pool.getThreadCount() << "\n";
+
+    start = std::chrono::steady_clock::now();
+    cache.getBatch(goals, pool);
+    std::cout << "cached=" << elapsedMs(start) << "ms hits=" << cache.getHits() << " misses=" << cache.getMisses() << "\n";
+    return 0;
+}
+
+// Headless repair run: random obstacle toggles repaired in place, compared
+// with regenerating the whole field and checked against a full rebuild
+int runRepairBenchmark(int gridSize, int changes) {
+    FlowField flowField(gridSize, gridSize, 1);
+    flowField.setMode(FlowFieldMode::Weighted);
+    srand(1);
+    for (int i = 0; i < gridSize * gridSize / 10; ++i) {
+        flowField.setObstacle(rand() % gridSize, rand() % gridSize);
     }
 
-    // Set a cell as an obstacle
-    void setObstacle(int x, int y) {
-        if (x >= 0 && x < gridWidth && y >= 0 && y < gridHeight) {
-            flowField[x][y].isObstacle = true;
+    auto elapsedMs = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    sf::Vector2f goal(gridSize / 2, gridSize / 2);
+    auto start = std::chrono::steady_clock::now();
+    flowField.generateFlowField(goal);
+    std::cout << "grid=" << gridSize << " full=" << elapsedMs(start) << "ms\n";
+
+    double repairMs = 0.0;
+    size_t touched = 0, mismatches = 0;
+    for (int i = 0; i < changes; ++i) {
+        int x = rand() % gridSize, y = rand() % gridSize;
+        start = std::chrono::steady_clock::now();
+        if (flowField.getCost(x, y) == OBSTACLE_COST) {
+            touched += flowField.removeObstacle(x, y);
+        } else {
+            touched += flowField.addObstacle(x, y);
         }
+        repairMs += elapsedMs(start);
+        mismatches += flowField.verifyLayer(flowField.getLayer());
     }
+    std::cout << "changes=" << changes << " repair=" << repairMs / changes << "ms touched="
+              << (double)touched / changes << " cells mismatches=" << mismatches << "\n";
+    return mismatches == 0 ? 0 : 1;
+}
 
-    // Get the flow direction at a specific position
-    sf::Vector2f getFlowDirection(sf::Vector2f position) {
-        int cellX = position.x / cellSize;
-        int cellY = position.y / cellSize;
-
-        // Make sure we don't go out of bounds
-        if (cellX < 0 || cellX >= gridWidth || cellY < 0 || cellY >= gridHeight)
-            return sf::Vector2f(0, 0); // Return zero if out of bounds
+// Headless bake run: generate a weighted field on a large map, save it packed,
+// map it back and compare startup time and memory with generating it
+int runBakeBenchmark(int gridSize, const std::string& path) {
+    FlowField flowField(gridSize, gridSize, 1);
+    flowField.setMode(FlowFieldMode::Weighted);
+    srand(1);
+    for (int i = 0; i < gridSize * gridSize / 10; ++i) {
+        flowField.setObstacle(rand() % gridSize, rand() % gridSize);
+    }
 
-        return flowField[cellX][cellY].direction;
+    auto elapsedMs = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    flowField.generateFlowField(sf::Vector2f(gridSize / 2, gridSize / 2));
+    const FlowFieldLayer& layer = flowField.getLayer();
+    size_t layerBytes = layer.integration.size() * sizeof(uint32_t) + layer.directions.size();
+    std::cout << "grid=" << gridSize << " generate=" << elapsedMs(start) << "ms layer=" << layerBytes / 1024 << "KiB\n";
+
+    start = std::chrono::steady_clock::now();
+    if (!saveFlowFieldFile(path, flowField, layer))
+        return 1;
+    std::cout << "save=" << elapsedMs(start) << "ms path=" << path << "\n";
+
+    MappedFlowField mapped;
+    start = std::chrono::steady_clock::now();
+    if (!mapped.open(path))
+        return 1;
+    std::cout << "open=" << elapsedMs(start) << "ms file=" << mapped.getFileSize() / 1024 << "KiB matches="
+              << mapped.matches(flowField) << "\n";
+
+    size_t mismatches = 0;
+    for (int y = 0; y < gridSize; ++y) {
+        for (int x = 0; x < gridSize; ++x) {
+            uint8_t expected = flowField.getCost(x, y) == OBSTACLE_COST ? DIRECTION_NONE : layer.directions[y * gridSize + x];
+            mismatches += mapped.getDirectionCode(x, y) != expected;
+        }
     }
+    std::cout << "mismatches=" << mismatches << "\n";
+    return mismatches == 0 ? 0 : 1;
+}
 
-private:
-    int width, height, cellSize;
-    int gridWidth, gridHeight;
-    std::vector<std::vector<FlowFieldCell>> flowField;
-};
+// Headless render run into an off-screen texture: CPU time per frame for
+// one draw per shape against two batched layers (static terrain plus the
+// agents), as the agent count grows to `maxAgents`
+int runRenderBenchmark(size_t maxAgents, int frames) {
+    sf::RenderTexture target;
+    if (!target.create(WINDOW_WIDTH, WINDOW_HEIGHT)) {
+        std::cerr << "Could not create a render texture\n";
+        return 1;
+    }
 
-// Function to generate a random position on the screen's edge
-sf::Vector2f generateRandomEdgePosition() {
-    int side = rand() % 4;
+    srand(1);
+    std::vector<sf::RectangleShape> terrainShapes;
+    BatchLayer terrain(BatchLayer::Static);
+    for (int i = 0; i < 400; ++i) {
+        sf::RectangleShape cell(sf::Vector2f(GRID_SIZE, GRID_SIZE));
+        cell.setFillColor(i % 2 ? sf::Color::Red : sf::Color(150, 110, 60));
+        cell.setPosition(rand() % (WINDOW_WIDTH / GRID_SIZE) * GRID_SIZE, rand() % (WINDOW_HEIGHT / GRID_SIZE) * GRID_SIZE);
+        terrainShapes.push_back(cell);
+        terrain.addShape(cell);
+    }
 
-    if (side == 0) { // Top
-        return sf::Vector2f(rand() % WINDOW_WIDTH, 0);
-    } else if (side == 1) { // Bottom
-        return sf::Vector2f(rand() % WINDOW_WIDTH, WINDOW_HEIGHT);
-    } else if (side == 2) { // Left
-        return sf::Vector2f(0, rand() % WINDOW_HEIGHT);
-    } else { // Right
-        return sf::Vector2f(WINDOW_WIDTH, rand() % WINDOW_HEIGHT);
+    std::cout << "frames=" << frames << " vbo=" << sf::VertexBuffer::isAvailable() << "\n";
+    for (size_t agentCount = std::min<size_t>(500, maxAgents);; agentCount = std::min(agentCount * 4, maxAgents)) {
+        AgentSystem agents(agentCount, WINDOW_WIDTH, WINDOW_HEIGHT, SQUARE_SIZE, 1);
+        sf::RectangleShape agentShape(sf::Vector2f(SQUARE_SIZE, SQUARE_SIZE));
+        agentShape.setFillColor(sf::Color::Blue);
+        BatchLayer agentLayer;
+        agentLayer.reserveQuads(agentCount);
+
+        for (int batched = 0; batched < 2; ++batched) {
+            auto start = std::chrono::steady_clock::now();
+            for (int frame = 0; frame < frames; ++frame) {
+                target.clear(sf::Color::White);
+                if (batched) {
+                    target.draw(terrain);
+                    agentLayer.clear();
+                    for (size_t i = 0; i < agents.size(); i++) {
+                        agentLayer.addRect(agents.getPosition(i), sf::Vector2f(SQUARE_SIZE, SQUARE_SIZE), sf::Color::Blue);
+                    }
+                    target.draw(agentLayer);
+                } else {
+                    for (const auto& cell : terrainShapes) {
+                        target.draw(cell);
+                    }
+                    for (size_t i = 0; i < agents.size(); i++) {
+                        agentShape.setPosition(agents.getPosition(i));
+                        target.draw(agentShape);
+                    }
+                }
+                target.display();
+            }
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            size_t drawCalls = batched ? 2 : terrainShapes.size() + agentCount;
+            std::cout << "agents=" << agentCount << (batched ? " batched" : " per-shape") << " draws=" << drawCalls
+                      << " frame=" << ms / frames << "ms\n";
+        }
+        if (agentCount == maxAgents)
+            break;
     }
+    return 0;
 }
 
-// Function to clamp position inside window bounds
-sf::Vector2f clampToWindowBounds(sf::Vector2f position) {
-    position.x = std::max(0.f, std::min(position.x, (float)WINDOW_WIDTH - SQUARE_SIZE));
-    position.y = std::max(0.f, std::min(position.y, (float)WINDOW_HEIGHT - SQUARE_SIZE));
-    return position;
+// Headless culling run: a crowd on a field `screens` windows across, with a
+// window-sized view panning over it. Per frame, batching every agent is
+// timed against looking up the visible ones in the agent grid and batching
+// those, and the lookup is checked against testing every agent.
+int runCullBenchmark(size_t agentCount, int screens, int frames) {
+    const float worldWidth = WINDOW_WIDTH * screens, worldHeight = WINDOW_HEIGHT * screens;
+    FlowField flowField(worldWidth, worldHeight, GRID_SIZE);
+    sf::Vector2f goal(worldWidth / 2, worldHeight / 2);
+    flowField.generateFlowField(goal);
+
+    ThreadPool pool;
+    AgentSystem agents(agentCount, worldWidth, worldHeight, SQUARE_SIZE, 1);
+    BatchLayer layer;
+    std::vector<uint32_t> visible;
+    double allUs = 0.0, visibleUs = 0.0;
+    size_t drawn = 0, mismatches = 0;
+    for (int frame = 0; frame < frames; ++frame) {
+        agents.update(flowField, goal, AGENT_SPEED, pool);
+        // Diagonally across the world, so the view crosses crowds and empty ground
+        float t = (float)frame / std::max(1, frames - 1);
+        sf::FloatRect view((worldWidth - WINDOW_WIDTH) * t, (worldHeight - WINDOW_HEIGHT) * t, WINDOW_WIDTH, WINDOW_HEIGHT);
+
+        auto start = std::chrono::steady_clock::now();
+        layer.clear();
+        for (size_t i = 0; i < agents.size(); i++) {
+            layer.addRect(agents.getPosition(i), sf::Vector2f(SQUARE_SIZE, SQUARE_SIZE), sf::Color::Blue);
+        }
+        allUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        layer.clear();
+        agents.collectVisible(view, visible);
+        for (uint32_t i : visible) {
+            layer.addRect(agents.getPosition(i), sf::Vector2f(SQUARE_SIZE, SQUARE_SIZE), sf::Color::Blue);
+        }
+        visibleUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        drawn += visible.size();
+
+        size_t expected = 0;
+        for (size_t i = 0; i < agents.size(); i++) {
+            sf::Vector2f position = agents.getPosition(i);
+            expected += position.x + SQUARE_SIZE >= view.left && position.x <= view.left + view.width &&
+                        position.y + SQUARE_SIZE >= view.top && position.y <= view.top + view.height;
+        }
+        mismatches += expected != visible.size();
+    }
+
+    std::cout << "agents=" << agentCount << " world=" << screens << "x" << screens << " screens frames=" << frames << "\n";
+    std::cout << "all: quads/frame=" << agentCount << " batch=" << allUs / frames << "us\n";
+    std::cout << "culled: quads/frame=" << drawn / frames << " lookup+batch=" << visibleUs / frames << "us mismatches=" << mismatches
+              << "\n";
+    return mismatches == 0 ? 0 : 1;
 }
 
-int main() {
+int main(int argc, char** argv) {
+    // ./game --bench [agents] [maxThreads] [frames]
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        size_t agentCount = argc > 2 ? std::stoul(argv[2]) : 100000;
+        unsigned maxThreads = argc > 3 ? std::stoul(argv[3]) : std::max(1u, std::thread::hardware_concurrency());
+        int frames = argc > 4 ? std::stoi(argv[4]) : 200;
+        return runAgentBenchmark(agentCount, maxThreads, frames);
+    }
+    // ./game --bench-crowd [agents] [frames]
+    if (argc > 1 && std::string(argv[1]) == "--bench-crowd") {
+        return runCrowdBenchmark(argc > 2 ? std::stoul(argv[2]) : 100000, argc > 3 ? std::stoi(argv[3]) : 100);
+    }
+    // ./game --bench-goals [squads] [gridSize]
+    if (argc > 1 && std::string(argv[1]) == "--bench-goals") {
+        return runGoalBenchmark(argc > 2 ? std::stoi(argv[2]) : 32, argc > 3 ? std::stoi(argv[3]) : 1000);
+    }
+    // ./game --bench-sectors [gridSize]
+    if (argc > 1 && std::string(argv[1]) == "--bench-sectors") {
+        return runSectorBenchmark(argc > 2 ? std::stoi(argv[2]) : 10000);
+    }
+    // ./game --bake [gridSize] [path]
+    if (argc > 1 && std::string(argv[1]) == "--bake") {
+        return runBakeBenchmark(argc > 2 ? std::stoi(argv[2]) : 4096, argc > 3 ? argv[3] : "field.ffl");
+    }
+    // ./game --bench-repair [gridSize] [changes]
+    if (argc > 1 && std::string(argv[1]) == "--bench-repair") {
+        return runRepairBenchmark(argc > 2 ? std::stoi(argv[2]) : 1000, argc > 3 ? std::stoi(argv[3]) : 200);
+    }
+    // ./game --bench-render [maxAgents] [frames]
+    if (argc > 1 && std::string(argv[1]) == "--bench-render") {
+        return runRenderBenchmark(argc > 2 ? std::stoul(argv[2]) : 100000, argc > 3 ? std::stoi(argv[3]) : 60);
+    }
+
+    // ./game --bench-cull [agents] [screens] [frames]
+    if (argc > 1 && std::string(argv[1]) == "--bench-cull") {
+        return runCullBenchmark(argc > 2 ? std::stoul(argv[2]) : 100000, argc > 3 ? std::stoi(argv[3]) : 10,
+                                argc > 4 ? std::stoi(argv[4]) : 120);
+    }
+
+    // ./game --screens n: a world n windows across and down, with n * n
+    // times the agents, obstacles and mud
+    int screens = 1;
+    if (argc > 2 && std::string(argv[1]) == "--screens")
+        screens = std::max(1, std::stoi(argv[2]));
+    const int worldWidth = WINDOW_WIDTH * screens;
+    const int worldHeight = WINDOW_HEIGHT * screens;
+
     srand(time(0));
 
     // Create window
     sf::RenderWindow window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), "Flow Field with Obstacles");
 
+    // Middle drag, the wheel and the arrow keys move around the world
+    Camera camera(sf::Vector2f(WINDOW_WIDTH, WINDOW_HEIGHT));
+    camera.setBounds(sf::FloatRect(0, 0, worldWidth, worldHeight));
+    sf::Clock frameClock;
+
     // Create the flow field
-    FlowField flowField(WINDOW_WIDTH, WINDOW_HEIGHT, GRID_SIZE);
+    FlowField flowField(worldWidth, worldHeight, GRID_SIZE);
 
     // Create a green square (target)
     sf::RectangleShape greenSquare(sf::Vector2f(SQUARE_SIZE, SQUARE_SIZE));
     greenSquare.setFillColor(sf::Color::Green);
 
     // Create a collection of blue squares (agents)
-    std::vector<sf::Vector2f> blueSquares;
-    std::vector<sf::RectangleShape> blueSquareShapes;
-    for (int i = 0; i < NUM_BLUE_SQUARES; ++i) {
-        blueSquares.push_back(generateRandomEdgePosition());
-        sf::RectangleShape blueSquareShape(sf::Vector2f(SQUARE_SIZE, SQUARE_SIZE));
-        blueSquareShape.setFillColor(sf::Color::Blue);
-        blueSquareShapes.push_back(blueSquareShape);
-    }
+    AgentSystem blueSquares(NUM_BLUE_SQUARES * screens * screens, worldWidth, worldHeight, SQUARE_SIZE, time(0));
+    sf::RectangleShape blueSquareShape(sf::Vector2f(SQUARE_SIZE, SQUARE_SIZE));
+    blueSquareShape.setFillColor(sf::Color::Blue);
+    blueSquares.setSeparation(SEPARATION_RADIUS, SEPARATION_STRENGTH);
+    ThreadPool pool;
+    sf::Clock reportClock;
+    GameLoop loop(1.0f / 60.0f);
 
     // Create obstacles (red squares)
     std::vector<sf::RectangleShape> redSquareShapes;
-    for (int i = 0; i < 10; ++i) {
-        sf::Vector2f pos(rand() % (WINDOW_WIDTH / GRID_SIZE) * GRID_SIZE, rand() % (WINDOW_HEIGHT / GRID_SIZE) * GRID_SIZE);
+    for (int i = 0; i < 10 * screens * screens; ++i) {
+        sf::Vector2f pos(rand() % (worldWidth / GRID_SIZE) * GRID_SIZE, rand() % (worldHeight / GRID_SIZE) * GRID_SIZE);
         redSquareShapes.push_back(sf::RectangleShape(sf::Vector2f(GRID_SIZE, GRID_SIZE)));
         redSquareShapes.back().setFillColor(sf::Color::Red);
         redSquareShapes.back().setPosition(pos);
@@ -164,57 +450,161 @@ int main() {
         flowField.setObstacle(pos.x / GRID_SIZE, pos.y / GRID_SIZE);
     }
 
+    // Create mud patches (brown squares), only slower in weighted mode
+    std::vector<sf::RectangleShape> mudShapes;
+    for (int i = 0; i < 5 * screens * screens; ++i) {
+        int patchX = rand() % (worldWidth / GRID_SIZE - 4);
+        int patchY = rand() % (worldHeight / GRID_SIZE - 4);
+        for (int x = patchX; x < patchX + 4; ++x) {
+            for (int y = patchY; y < patchY + 4; ++y) {
+                if (flowField.getCost(x, y) == OBSTACLE_COST)
+                    continue;
+                flowField.setCost(x, y, MUD_COST);
+                mudShapes.push_back(sf::RectangleShape(sf::Vector2f(GRID_SIZE, GRID_SIZE)));
+                mudShapes.back().setFillColor(sf::Color(150, 110, 60));
+                mudShapes.back().setPosition(x * GRID_SIZE, y * GRID_SIZE);
+            }
+        }
+    }
+
+    // Mud and obstacles only change on a right click, so they live in
+    // static layers uploaded once; the squares are re-batched every frame.
+    // They are two layers so the green target can sit between them.
+    BatchLayer mudLayer(BatchLayer::Static);
+    BatchLayer obstacleLayer(BatchLayer::Static);
+    auto rebuildTerrain = [&]() {
+        mudLayer.clear();
+        for (const auto& mud : mudShapes) {
+            mudLayer.addShape(mud);
+        }
+        obstacleLayer.clear();
+        for (const auto& redSquare : redSquareShapes) {
+            obstacleLayer.addShape(redSquare);
+        }
+    };
+    rebuildTerrain();
+    BatchLayer squares;
+    std::vector<uint32_t> visibleSquares;
+
+    // Hierarchical field over the same costs, built lazily per sector
+    SectorFlowField sectorField(flowField, SECTOR_SIZE);
+    bool hierarchical = false;
+
+    // Revisited goals come straight from the cache
+    FlowFieldCache fieldCache(flowField, FIELD_CACHE_SIZE);
+    std::shared_ptr<const FlowFieldLayer> activeField = std::make_shared<FlowFieldLayer>();
+
+    // Regenerate the flow field towards the green square and report how long it took
+    auto regenerate = [&]() {
+        auto start = std::chrono::steady_clock::now();
+        if (hierarchical) {
+            sectorField.setGoal(greenSquare.getPosition());
+        } else {
+            activeField = fieldCache.get(greenSquare.getPosition());
+        }
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+        std::cout << (hierarchical ? "Hierarchical" : flowField.getMode() == FlowFieldMode::Bfs ? "BFS" : "Weighted")
+                  << " flow field generated in " << elapsed.count() << " ms\n";
+    };
+
     // Main loop
     while (window.isOpen()) {
         sf::Event event;
         while (window.pollEvent(event)) {
             if (event.type == sf::Event::Closed)
                 window.close();
+            if (camera.handleEvent(event, window))
+                continue;
             if (event.type == sf::Event::MouseButtonPressed) {
+                sf::Vector2f mouse = camera.toWorld(sf::Vector2i(event.mouseButton.x, event.mouseButton.y), window);
                 // Move the green square to the mouse position
                 if (event.mouseButton.button == sf::Mouse::Left) {
-                    greenSquare.setPosition(event.mouseButton.x - SQUARE_SIZE / 2, event.mouseButton.y - SQUARE_SIZE / 2);
-                    flowField.generateFlowField(greenSquare.getPosition()); // Regenerate the flow field on click
+                    greenSquare.setPosition(mouse.x - SQUARE_SIZE / 2, mouse.y - SQUARE_SIZE / 2);
+                    regenerate(); // Regenerate the flow field on click
+                }
+                // Toggle an obstacle under the mouse and repair the field around it
+                if (event.mouseButton.button == sf::Mouse::Right && mouse.x >= 0 && mouse.x < worldWidth && mouse.y >= 0 &&
+                    mouse.y < worldHeight) {
+                    int cellX = (int)mouse.x / GRID_SIZE;
+                    int cellY = (int)mouse.y / GRID_SIZE;
+                    sf::Vector2f cellPos(cellX * GRID_SIZE, cellY * GRID_SIZE);
+                    bool blocked = flowField.getCost(cellX, cellY) == OBSTACLE_COST;
+
+                    // Cached layers are shared, so the active one is repaired as a copy
+                    auto repaired = std::make_shared<FlowFieldLayer>(*activeField);
+                    auto start = std::chrono::steady_clock::now();
+                    size_t touched = flowField.changeCost(cellX, cellY, blocked ? DEFAULT_COST : OBSTACLE_COST, *repaired);
+                    auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+                    activeField = repaired;
+                    sectorField.rebuild();
+                    std::cout << "Repaired " << touched << " cells in " << elapsed.count() << " ms\n";
+
+                    if (blocked) {
+                        redSquareShapes.erase(std::remove_if(redSquareShapes.begin(), redSquareShapes.end(),
+                            [&](const sf::RectangleShape& shape) { return shape.getPosition() == cellPos; }), redSquareShapes.end());
+                    } else {
+                        // Mud under a new obstacle is gone once it's removed again
+                        mudShapes.erase(std::remove_if(mudShapes.begin(), mudShapes.end(),
+                            [&](const sf::RectangleShape& shape) { return shape.getPosition() == cellPos; }), mudShapes.end());
+                        redSquareShapes.push_back(sf::RectangleShape(sf::Vector2f(GRID_SIZE, GRID_SIZE)));
+                        redSquareShapes.back().setFillColor(sf::Color::Red);
+                        redSquareShapes.back().setPosition(cellPos);
+                    }
+                    rebuildTerrain();
                 }
             }
-        }
-
-        // Update the movement of the blue squares towards the green square
-        for (auto& blueSquare : blueSquares) {
-            // Get the flow direction at the blue square's current position
-            sf::Vector2f flow = flowField.getFlowDirection(blueSquare);
-
-            // Adjust the movement based on the flow direction
-            if (flow != sf::Vector2f(0, 0)) {
-                blueSquare += flow * -0.1f; // Adjust speed
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::M) {
+                // Toggle between the BFS and weighted integration modes
+                flowField.setMode(flowField.getMode() == FlowFieldMode::Bfs ? FlowFieldMode::Weighted : FlowFieldMode::Bfs);
+                hierarchical = false;
+                regenerate();
             }
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::S) {
+                // Toggle crowd separation
+                blueSquares.setSeparation(SEPARATION_RADIUS, blueSquares.hasSeparation() ? 0.f : SEPARATION_STRENGTH);
+            }
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::H) {
+                // Toggle hierarchical (sectored) mode
+                hierarchical = !hierarchical;
+                regenerate();
+            }
+        }
 
-            // Clamp the blue square position to the window bounds
-            blueSquare = clampToWindowBounds(blueSquare);
-
-            // Check if a blue square touches the green square
-            if (std::abs(blueSquare.x - greenSquare.getPosition().x) < SQUARE_SIZE &&
-                std::abs(blueSquare.y - greenSquare.getPosition().y) < SQUARE_SIZE) {
-                // Reassign the blue square to a random position on the edge
-                blueSquare = generateRandomEdgePosition();
+        // Update the movement of the blue squares towards the green square,
+        // AGENT_SPEED per 60 Hz step whatever the frame rate
+        for (int steps = loop.advance(); steps > 0; --steps) {
+            if (hierarchical) {
+                blueSquares.update(sectorField, greenSquare.getPosition(), AGENT_SPEED, pool);
+            } else {
+                blueSquares.update(flowField, *activeField, greenSquare.getPosition(), AGENT_SPEED, pool);
             }
         }
+        camera.update(frameClock.restart().asSeconds());
+
+        // Only the squares in view are batched, looked up in the agent grid
+        blueSquares.collectVisible(camera.getVisibleRect(), visibleSquares);
+        if (reportClock.getElapsedTime().asSeconds() > 1.f) {
+            window.setTitle("Flow Field with Obstacles - " + std::to_string((long long)blueSquares.getAgentsPerSecond()) + " agents/s, " +
+                            std::to_string(visibleSquares.size()) + "/" + std::to_string(blueSquares.size()) + " drawn");
+            reportClock.restart();
+        }
 
         window.clear(sf::Color::White);
-        window.draw(greenSquare);
+        window.setView(camera.getView());
 
-        // Draw the red obstacles
-        for (const auto& redSquare : redSquareShapes) {
-            window.draw(redSquare);
-        }
-
-        // Draw the blue squares
-        for (size_t i = 0; i < NUM_BLUE_SQUARES; i++) {
-            blueSquareShapes[i].setPosition(blueSquares[i]);
-            window.draw(blueSquareShapes[i]);
+        // Mud patches, the green target, red obstacles, then the blue squares
+        window.draw(mudLayer);
+        window.draw(greenSquare);
+        window.draw(obstacleLayer);
+        squares.clear();
+        squares.reserveQuads(visibleSquares.size());
+        for (uint32_t i : visibleSquares) {
+            squares.addRect(blueSquares.getPosition(i), blueSquareShape.getSize(), blueSquareShape.getFillColor());
         }
+        window.draw(squares);
 
         window.display();
+        loop.pace();
     }
 
     return 0;
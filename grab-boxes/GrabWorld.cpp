@@ -0,0 +1,190 @@
+#include "GrabWorld.hpp"
+
+#include "../common/TransformSync.hpp"
+
+namespace {
+
+b2WorldId createWorld(const WorldParams& params) {
+    b2WorldDef worldDef = b2DefaultWorldDef();
+    worldDef.gravity = (b2Vec2){0.0f, params.gravity};
+    return createWorldLocked(worldDef);
+}
+
+void createGround(b2WorldId worldId) {
+    b2BodyDef groundBodyDef = b2DefaultBodyDef();
+    groundBodyDef.position = (b2Vec2){400.0f / SCALE, 570.0f / SCALE};
+    b2BodyId groundId = b2CreateBody(worldId, &groundBodyDef);
+    b2Polygon groundBox = b2MakeBox(400.0f / SCALE, 10.0f / SCALE);
+    b2ShapeDef groundShapeDef = b2DefaultShapeDef();
+    b2CreatePolygonShape(groundId, &groundShapeDef, &groundBox);
+}
+
+// Green square
+b2BodyId createPlayer(b2WorldId worldId) {
+    b2BodyDef playerDef = b2DefaultBodyDef();
+    playerDef.type = b2_dynamicBody;
+    playerDef.position = (b2Vec2){400.0f / SCALE, 500.0f / SCALE};
+    playerDef.fixedRotation = true;
+    b2BodyId playerId = b2CreateBody(worldId, &playerDef);
+
+    b2Polygon playerBox = b2MakeBox(40.0f / SCALE, 40.0f / SCALE);
+    b2ShapeDef playerShapeDef = b2DefaultShapeDef();
+    playerShapeDef.density = 1.0f;
+    playerShapeDef.friction = 0.3f;
+    b2CreatePolygonShape(playerId, &playerShapeDef, &playerBox);
+
+    // Add damping to slow movement over time
+    b2Body_SetLinearDamping(playerId, 3.0f);
+    return playerId;
+}
+
+// Box bodies carry their pool slot as a TransformSync slot (null user data
+// means not a box)
+bool isBoxBody(b2BodyId bodyId) { return b2Body_GetUserData(bodyId) != nullptr; }
+
+} // namespace
+
+GrabWorld::GrabWorld(const WorldParams& params, uint32_t seed)
+    : params(params), worldId(createWorld(params)), playerId(createPlayer(worldId)), boxes(MAX_BOXES), bodies(SCALE),
+      query(worldId), random(seed) {
+    createGround(worldId);
+
+    // Every box is a 60x60 blue quad
+    boxArchetype = bodies.addArchetype(sf::Vector2f(60, 60), sf::Color::Blue);
+
+    // Grabbing asks Box2D's broad phase for the nearest box instead of
+    // scanning them all
+    query.setShapeFilter([](b2ShapeId shapeId) { return isBoxBody(b2Shape_GetBody(shapeId)); });
+}
+
+GrabWorld::~GrabWorld() {
+    destroyWorldLocked(worldId);
+}
+
+bool GrabWorld::grab() {
+    if (isGrabbing())
+        return true;
+
+    b2Vec2 playerPos = b2Body_GetPosition(playerId);
+    uint32_t slot;
+    if (query.queryNearest(playerPos, 1, GRAB_RADIUS / SCALE, hits) > 0 &&
+        TransformSync::slotOf(b2Body_GetUserData(hits[0].bodyId), slot)) {
+        grabbedBox = boxes.getHandle(slot);
+    }
+    return isGrabbing();
+}
+
+void GrabWorld::step() {
+    b2Vec2 velocity = b2Body_GetLinearVelocity(playerId);
+    velocity.x = playerDirection * PLAYER_SPEED;
+    b2Body_SetLinearVelocity(playerId, velocity);
+
+    // Spawn falling boxes at intervals
+    sinceSpawn += GRAB_TIME_STEP;
+    if (sinceSpawn > spawnInterval) {
+        spawnBox((float)(random() % 800));
+        sinceSpawn = 0.0f;
+    }
+
+    b2World_Step(worldId, GRAB_TIME_STEP, params.subStepCount);
+    ++stepCount;
+    bodies.update(worldId);
+
+    despawnIdleBoxes();
+
+    // Move grabbed box with player
+    if (Box* held = boxes.get(grabbedBox)) {
+        b2Vec2 playerPos = b2Body_GetPosition(playerId);
+        b2Body_SetTransform(held->bodyId, (b2Vec2){playerPos.x, playerPos.y - (50.0f / SCALE)}, b2Rot_identity);
+    }
+}
+
+sf::Vector2f GrabWorld::getPlayerPosition() const {
+    b2Vec2 position = b2Body_GetPosition(playerId);
+    return sf::Vector2f(position.x * SCALE, position.y * SCALE);
+}
+
+size_t GrabWorld::getAwakeCount() const {
+    size_t awake = 0;
+    boxes.forEach([&](EntityHandle, const Box& box) { awake += b2Body_IsAwake(box.bodyId); });
+    return awake;
+}
+
+// Drop a box at x (pixels) along the top edge, recycling the oldest box
+// (other than the held one) when the population cap is reached
+void GrabWorld::spawnBox(float x) {
+    if (boxes.size() >= MAX_BOXES) {
+        EntityHandle oldest;
+        uint64_t oldestOrder = UINT64_MAX;
+        boxes.forEach([&](EntityHandle handle, const Box& box) {
+            if (handle != grabbedBox && box.spawnOrder < oldestOrder) {
+                oldest = handle;
+                oldestOrder = box.spawnOrder;
+            }
+        });
+        despawnBox(oldest);
+    }
+
+    bool reused = false;
+    EntityHandle handle = boxes.create(&reused);
+    Box& box = *boxes.get(handle);
+    b2Vec2 position = (b2Vec2){x / SCALE, 0.0f};
+
+    if (reused) {
+        b2Body_SetTransform(box.bodyId, position, b2Rot_identity);
+        b2Body_SetLinearVelocity(box.bodyId, (b2Vec2){0.0f, 0.0f});
+        b2Body_SetAngularVelocity(box.bodyId, 0.0f);
+        b2Body_Enable(box.bodyId);
+        b2Body_SetAwake(box.bodyId, true);
+        bodies.setFlags(handle.index, 0);
+        bodies.resetTransform(handle.index); // It jumps to the top, it doesn't slide there
+    } else {
+        b2BodyDef boxDef = b2DefaultBodyDef();
+        boxDef.type = b2_dynamicBody;
+        boxDef.position = position;
+        box.bodyId = b2CreateBody(worldId, &boxDef);
+
+        b2Polygon boxShape = b2MakeBox(30.0f / SCALE, 30.0f / SCALE);
+        b2ShapeDef shapeDef = b2DefaultShapeDef();
+        shapeDef.density = 1.0f;
+        shapeDef.friction = params.friction;
+        b2CreatePolygonShape(box.bodyId, &shapeDef, &boxShape);
+
+        b2Body_SetLinearDamping(box.bodyId, params.linearDamping); // Slows falling objects
+
+        // New slots are always the next index, so the body stays with this slot
+        bodies.create(box.bodyId, boxArchetype);
+    }
+
+    box.spawnOrder = spawned++;
+    box.asleepFor = 0.0f;
+}
+
+// Free a box's slot. The body is only disabled and its registry entry
+// hidden, so a later spawn reuses both instead of creating new ones.
+void GrabWorld::despawnBox(EntityHandle handle) {
+    Box* box = boxes.get(handle);
+    if (!box)
+        return;
+    b2Body_Disable(box->bodyId);
+    bodies.setFlags(handle.index, BODY_HIDDEN);
+    boxes.destroy(handle);
+    ++recycled;
+}
+
+// Recycle boxes that left the screen or have been asleep too long. The
+// grabbed box is never despawned.
+void GrabWorld::despawnIdleBoxes() {
+    boxes.forEach([&](EntityHandle handle, Box& box) {
+        if (handle == grabbedBox)
+            return;
+
+        b2Vec2 pos = b2Body_GetPosition(box.bodyId);
+        float x = pos.x * SCALE, y = pos.y * SCALE;
+        bool offScreen = x < -OFFSCREEN_MARGIN || x > 800 + OFFSCREEN_MARGIN || y > 600 + OFFSCREEN_MARGIN;
+
+        box.asleepFor = b2Body_IsAwake(box.bodyId) ? 0.0f : box.asleepFor + GRAB_TIME_STEP;
+        if (offScreen || box.asleepFor > SLEEP_DESPAWN_SECONDS)
+            despawnBox(handle);
+    });
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <box2d/box2d.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "../common/BodyRegistry.hpp"
+#include "../common/EntityPool.hpp"
+#include "../common/PhysicsQuery.hpp"
+#include "../common/WorldSweep.hpp"
+
+const float SCALE = 30.0f;
+const float PLAYER_SPEED = 2.0f; // Reduced speed
+const float GRAB_RADIUS = 50.0f;
+const float GRAB_TIME_STEP = 1.0f / 60.0f;
+
+const float SPAWN_INTERVAL = 1.5f;       // Seconds between falling boxes
+const size_t MAX_BOXES = 40;             // Oldest box is recycled above this
+const float SLEEP_DESPAWN_SECONDS = 10.0f; // Boxes asleep this long are recycled
+const float OFFSCREEN_MARGIN = 100.0f;   // Pixels past the window edges
+
+// The demo's own tuning: reduced gravity, and boxes damped so they drift down
+const WorldParams GRAB_PARAMS = {3.0f, 2.0f, 0.3f, 4};
+
+// Gameplay state per pool slot. How the box looks lives in a BodyRegistry
+// at the same index as the slot, so the pool only holds what the rules need.
+struct Box {
+    b2BodyId bodyId = b2_nullBodyId;
+    uint64_t spawnOrder = 0; // Lower is older
+    float asleepFor = 0.0f;  // Seconds since the body fell asleep
+};
+
+typedef EntityPool<Box> BoxPool;
+
+// The grab-boxes world without a window: ground, player, the pooled
+// falling boxes and the grab rules, stepped at a fixed 60 Hz. Input comes in
+// through setPlayerDirection/grab/release and spawn positions from the
+// seed, so it runs the same in the game, the soak test and a sweep.
+class GrabWorld {
+public:
+    explicit GrabWorld(const WorldParams& params = GRAB_PARAMS, uint32_t seed = 1);
+    ~GrabWorld();
+
+    GrabWorld(const GrabWorld&) = delete;
+    GrabWorld& operator=(const GrabWorld&) = delete;
+
+    void setSpawnInterval(float seconds) { spawnInterval = seconds; }
+
+    // -1 walks left, 1 right, 0 stands still
+    void setPlayerDirection(int direction) { playerDirection = direction; }
+
+    // Pick up the nearest box within GRAB_RADIUS; false if none is in reach.
+    // A held box is carried above the player and never recycled.
+    bool grab();
+    void release() { grabbedBox = EntityHandle(); }
+    bool isGrabbing() const { return boxes.isValid(grabbedBox); }
+
+    // One fixed step: spawn on schedule, step Box2D, sync the registry,
+    // recycle idle boxes and carry the held one
+    void step();
+
+    // Pixels
+    sf::Vector2f getPlayerPosition() const;
+
+    b2WorldId getWorldId() const { return worldId; }
+    const BoxPool& getBoxes() const { return boxes; }
+    // Pool slot i is registry index i; despawned slots are hidden
+    const BodyRegistry& getBodies() const { return bodies; }
+    size_t getAwakeCount() const;
+    uint64_t getSpawnedCount() const { return spawned; }
+    uint64_t getRecycledCount() const { return recycled; }
+    long getStepCount() const { return stepCount; }
+
+private:
+    void spawnBox(float x);
+    void despawnBox(EntityHandle handle);
+    void despawnIdleBoxes();
+
+    WorldParams params;
+    b2WorldId worldId;
+    b2BodyId playerId;
+    BoxPool boxes;
+    BodyRegistry bodies;
+    uint16_t boxArchetype;
+    PhysicsQuery query;
+    std::vector<QueryHit> hits;
+    std::mt19937 random;
+    float spawnInterval = SPAWN_INTERVAL;
+    float sinceSpawn = 0.0f;
+    int playerDirection = 0;
+    EntityHandle grabbedBox; // A handle, so a despawned box can't be held
+    uint64_t spawned = 0;
+    uint64_t recycled = 0;
+    long stepCount = 0;
+};
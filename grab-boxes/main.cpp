@@ -1,65 +1,111 @@
 #include <SFML/Graphics.hpp>
 #include <box2d/box2d.h>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
+#include <string>
 #include <vector>
 #include <cmath>
+#include <algorithm>
+#include "GrabWorld.hpp"
+#include "../common/BatchLayer.hpp"
+#include "../common/GameLoop.hpp"
+#include "../common/WorldSweep.hpp"
+
+// Headless soak: spawn and despawn at a fixed step for `minutes` of
+// simulated time, printing the pool and Box2D sizes and the step time once a
+// simulated minute. All of them should level off after the first minutes.
+int runSoak(float minutes, float spawnInterval) {
+    GrabWorld world;
+    world.setSpawnInterval(spawnInterval);
+    const long stepsPerMinute = 60 * 60;
+    long totalSteps = (long)(minutes * stepsPerMinute);
+
+    double stepMs = 0.0;
+    size_t firstSlots = 0;
+    int firstBodies = 0;
+    for (long step = 1; step <= totalSteps; step++) {
+        auto start = std::chrono::steady_clock::now();
+        world.step();
+        stepMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        if (step % stepsPerMinute == 0 || step == totalSteps) {
+            b2Counters counters = b2World_GetCounters(world.getWorldId());
+            long steps = step % stepsPerMinute == 0 ? stepsPerMinute : step % stepsPerMinute;
+            std::cout << "minute=" << (step + stepsPerMinute - 1) / stepsPerMinute << " spawned=" << world.getSpawnedCount()
+                      << " live=" << world.getBoxes().size() << " slots=" << world.getBoxes().getSlotCount()
+                      << " bodies=" << counters.bodyCount << " box2d bytes=" << counters.byteCount << " step=" << stepMs / steps
+                      << "ms\n";
+            stepMs = 0.0;
+            if (step == stepsPerMinute) {
+                firstSlots = world.getBoxes().getSlotCount();
+                firstBodies = counters.bodyCount;
+            }
+        }
+    }
+
+    b2Counters counters = b2World_GetCounters(world.getWorldId());
+    size_t slots = world.getBoxes().getSlotCount();
+    bool flat = totalSteps < stepsPerMinute ||
+                (slots <= MAX_BOXES && slots <= firstSlots + 1 && counters.bodyCount <= firstBodies + 1);
+    std::cout << "slots and bodies flat after the first minute: " << (flat ? "yes" : "no") << "\n";
+    return flat ? 0 : 1;
+}
 
-const float SCALE = 30.0f;
-const float PLAYER_SPEED = 2.0f; // Reduced speed
-const float GRAB_RADIUS = 50.0f;
+// Parameter sweep: one GrabWorld per configuration, with nobody at the
+// controls, for `steps` steps each. Reports how many boxes are left, how
+// many are still awake, how many were recycled and the worst step.
+int runSweep(const SweepOptions& options) {
+    std::vector<std::string> metrics = {"live", "awake", "recycled", "max_step_ms"};
+    return runWorldSweep(options, metrics, [](const WorldParams& params, long steps, SweepResult& result) {
+        GrabWorld world(params);
+        double maxStepMs = 0.0;
+        for (long step = 0; step < steps; step++) {
+            auto start = std::chrono::steady_clock::now();
+            world.step();
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            result.seconds += ms / 1000.0;
+            maxStepMs = std::max(maxStepMs, ms);
+        }
+        result.steps = steps;
+        result.metrics = {(double)world.getBoxes().size(), (double)world.getAwakeCount(), (double)world.getRecycledCount(),
+                          maxStepMs};
+    });
+}
 
-struct Box {
-    b2BodyId bodyId;
-    sf::RectangleShape shape;
-};
+int main(int argc, char** argv) {
+    // ./game --soak [minutes] [spawnInterval]
+    if (argc > 1 && std::string(argv[1]) == "--soak") {
+        return runSoak(argc > 2 ? std::stof(argv[2]) : 60.0f, argc > 3 ? std::stof(argv[3]) : SPAWN_INTERVAL);
+    }
+    // ./game --sweep [steps] [threads] [csvPath] [gravity=1,3 damping=0,2 friction=0.3 substeps=4 ...]
+    if (argc > 1 && std::string(argv[1]) == "--sweep") {
+        SweepOptions options;
+        return parseSweepOptions(argc, argv, 2, options) ? runSweep(options) : 1;
+    }
 
-int main() {
     sf::RenderWindow window(sf::VideoMode(800, 600), "SFML & Box2D - Grab Mechanic");
 
-    // Reduce gravity
-    b2WorldDef worldDef = b2DefaultWorldDef();
-    worldDef.gravity = (b2Vec2){0.0f, 3.0f}; // Reduced gravity
-    b2WorldId worldId = b2CreateWorld(&worldDef);
-
-    // Ground setup
-    b2BodyDef groundBodyDef = b2DefaultBodyDef();
-    groundBodyDef.position = (b2Vec2){400.0f / SCALE, 570.0f / SCALE};
-    b2BodyId groundId = b2CreateBody(worldId, &groundBodyDef);
-    b2Polygon groundBox = b2MakeBox(400.0f / SCALE, 10.0f / SCALE);
-    b2ShapeDef groundShapeDef = b2DefaultShapeDef();
-    b2CreatePolygonShape(groundId, &groundShapeDef, &groundBox);
+    // Ground, player and the box pool; the window only draws it and feeds
+    // it the keys
+    GrabWorld world;
 
     sf::RectangleShape groundRect(sf::Vector2f(800, 20));
     groundRect.setFillColor(sf::Color::Green);
     groundRect.setOrigin(400, 10);
     groundRect.setPosition(400, 570);
 
-    // Player (green square)
-    b2BodyDef playerDef = b2DefaultBodyDef();
-    playerDef.type = b2_dynamicBody;
-    playerDef.position = (b2Vec2){400.0f / SCALE, 500.0f / SCALE};
-    playerDef.fixedRotation = true;
-    b2BodyId playerId = b2CreateBody(worldId, &playerDef);
-
-    b2Polygon playerBox = b2MakeBox(40.0f / SCALE, 40.0f / SCALE);
-    b2ShapeDef playerShapeDef = b2DefaultShapeDef();
-    playerShapeDef.density = 1.0f;
-    playerShapeDef.friction = 0.3f;
-    b2CreatePolygonShape(playerId, &playerShapeDef, &playerBox);
-
-    // Add damping to slow movement over time
-    b2Body_SetLinearDamping(playerId, 3.0f); 
+    // The ground is uploaded once; player and boxes are one draw per frame
+    BatchLayer staticLayer(BatchLayer::Static);
+    staticLayer.addShape(groundRect);
+    BatchLayer bodyLayer;
 
     sf::RectangleShape playerRect(sf::Vector2f(80, 80));
     playerRect.setFillColor(sf::Color::Green);
     playerRect.setOrigin(40, 40);
 
-    std::vector<Box> boxes;
-
-    int subStepCount = 4;
-    sf::Clock clock;
-    bool isGrabbing = false;
-    Box* grabbedBox = nullptr;
+    GameLoop loop(GRAB_TIME_STEP);
 
     while (window.isOpen()) {
         sf::Event event;
@@ -69,91 +115,39 @@ int main() {
         }
 
         // Handle player movement
-        b2Vec2 velocity = b2Body_GetLinearVelocity(playerId);
         if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left)) {
-            velocity.x = -PLAYER_SPEED;
+            world.setPlayerDirection(-1);
         } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right)) {
-            velocity.x = PLAYER_SPEED;
+            world.setPlayerDirection(1);
         } else {
-            velocity.x = 0;
+            world.setPlayerDirection(0);
         }
-        b2Body_SetLinearVelocity(playerId, velocity);
 
         // Handle grabbing/releasing
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Space) && !isGrabbing) {
-            for (auto& box : boxes) {
-                b2Vec2 playerPos = b2Body_GetPosition(playerId);
-                b2Vec2 boxPos = b2Body_GetPosition(box.bodyId);
-                float dist = std::hypot((playerPos.x - boxPos.x) * SCALE, (playerPos.y - boxPos.y) * SCALE);
-
-                if (dist < GRAB_RADIUS) {
-                    grabbedBox = &box;
-                    isGrabbing = true;
-                    break;
-                }
-            }
-        } else if (!sf::Keyboard::isKeyPressed(sf::Keyboard::Space) && isGrabbing) {
-            grabbedBox = nullptr;
-            isGrabbing = false;
+        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Space)) {
+            world.grab();
+        } else {
+            world.release();
         }
 
-        // Spawn falling boxes at intervals
-        if (clock.getElapsedTime().asSeconds() > 1.5f) { // Increased interval to slow spawning
-            float spawnX = static_cast<float>(rand() % 800);
-            b2BodyDef boxDef = b2DefaultBodyDef();
-            boxDef.type = b2_dynamicBody;
-            boxDef.position = (b2Vec2){spawnX / SCALE, 0.0f};
-            b2BodyId boxId = b2CreateBody(worldId, &boxDef);
-
-            b2Polygon boxShape = b2MakeBox(30.0f / SCALE, 30.0f / SCALE);
-            b2ShapeDef shapeDef = b2DefaultShapeDef();
-            shapeDef.density = 1.0f;
-            shapeDef.friction = 0.3f;
-            b2CreatePolygonShape(boxId, &shapeDef, &boxShape);
-
-            b2Body_SetLinearDamping(boxId, 2.0f); // Slows falling objects
-
-            sf::RectangleShape shape(sf::Vector2f(60, 60));
-            shape.setFillColor(sf::Color::Blue);
-            shape.setOrigin(30, 30);
-            shape.setPosition(spawnX, 0);
-
-            boxes.push_back({boxId, shape});
-            clock.restart();
+        // Box2D physics steps at a fixed 60 Hz whatever the frame rate
+        for (int steps = loop.advance(); steps > 0; --steps) {
+            world.step();
         }
 
-        // Box2D physics step
-        float timeStep = 1.0f / 60.0f;
-        b2World_Step(worldId, timeStep, subStepCount);
-
         // Update player position
-        b2Vec2 playerPos = b2Body_GetPosition(playerId);
-        playerRect.setPosition(playerPos.x * SCALE, playerPos.y * SCALE);
-
-        // Update all falling boxes
-        for (auto& box : boxes) {
-            b2Vec2 pos = b2Body_GetPosition(box.bodyId);
-            b2Rot rotation = b2Body_GetRotation(box.bodyId);
-            box.shape.setPosition(pos.x * SCALE, pos.y * SCALE);
-            box.shape.setRotation(b2Rot_GetAngle(rotation) * 180.0f / b2_pi);
-        }
-
-        // Move grabbed box with player
-        if (isGrabbing && grabbedBox) {
-            b2Vec2 playerPos = b2Body_GetPosition(playerId);
-            b2Body_SetTransform(grabbedBox->bodyId, (b2Vec2){playerPos.x, playerPos.y - (50.0f / SCALE)}, {0});
-        }
+        playerRect.setPosition(world.getPlayerPosition());
 
         // Render scene
         window.clear();
-        window.draw(groundRect);
-        window.draw(playerRect);
-        for (const auto& box : boxes) {
-            window.draw(box.shape);
-        }
+        window.draw(staticLayer);
+        bodyLayer.clear();
+        bodyLayer.addShape(playerRect);
+        world.getBodies().appendTo(bodyLayer, loop.getAlpha()); // Despawned slots are hidden
+        window.draw(bodyLayer);
         window.display();
+        loop.pace();
     }
 
-    b2DestroyWorld(worldId);
     return 0;
 }